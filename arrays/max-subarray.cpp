@@ -2,6 +2,14 @@
 #include <vector>
 #include <algorithm>
 #include <climits>
+#include <tuple>
+#include "../datasets/dataset-layout.h"
+
+// Profiling hooks (see benchmarks/perf-counters.h); no-ops unless that header is included first
+#ifndef DSA_PERF_REGION
+#define DSA_PERF_REGION(name, elements)
+#define DSA_PERF_REGION_IF(condition, name, elements)
+#endif
 
 /**
  * Maximum Subarray Problem Solutions
@@ -11,6 +19,11 @@
  * 2. Divide and Conquer (O(n log n))
  * 3. Brute Force (O(n²))
  * 4. Prefix Sum approach
+ *
+ * Every approach takes a Span, so a vector and a memory-mapped dataset
+ * are handled the same way. Sums and indices are 64-bit: two large int
+ * elements already overflow an int sum, and datasets may pass 2^31
+ * elements.
  */
 
 class MaxSubarray {
@@ -19,14 +32,15 @@ public:
      * Kadane's Algorithm - Most efficient approach
      * Time: O(n), Space: O(1)
      */
-    static int kadane(const std::vector<int>& arr) {
+    static long long kadane(dsa::Span<const int> arr) {
         if (arr.empty()) return 0;
+        DSA_PERF_REGION("max-subarray/kadane", arr.size());
         
-        int maxCurrent = arr[0];
-        int maxGlobal = arr[0];
+        long long maxCurrent = arr[0];
+        long long maxGlobal = arr[0];
         
         for (size_t i = 1; i < arr.size(); i++) {
-            maxCurrent = std::max(arr[i], maxCurrent + arr[i]);
+            maxCurrent = std::max<long long>(arr[i], maxCurrent + arr[i]);
             maxGlobal = std::max(maxGlobal, maxCurrent);
         }
         
@@ -37,12 +51,13 @@ public:
      * Kadane's with subarray indices
      * Returns {maxSum, startIndex, endIndex}
      */
-    static std::tuple<int, int, int> kadaneWithIndices(const std::vector<int>& arr) {
+    static std::tuple<long long, long long, long long> kadaneWithIndices(dsa::Span<const int> arr) {
         if (arr.empty()) return {0, -1, -1};
+        DSA_PERF_REGION("max-subarray/kadane-indices", arr.size());
         
-        int maxSum = INT_MIN;
-        int currentSum = 0;
-        int start = 0, end = 0, tempStart = 0;
+        long long maxSum = LLONG_MIN;
+        long long currentSum = 0;
+        long long start = 0, end = 0, tempStart = 0;
         
         for (size_t i = 0; i < arr.size(); i++) {
             currentSum += arr[i];
@@ -50,12 +65,12 @@ public:
             if (currentSum > maxSum) {
                 maxSum = currentSum;
                 start = tempStart;
-                end = i;
+                end = static_cast<long long>(i);
             }
             
             if (currentSum < 0) {
                 currentSum = 0;
-                tempStart = i + 1;
+                tempStart = static_cast<long long>(i) + 1;
             }
         }
         
@@ -66,35 +81,38 @@ public:
      * Divide and Conquer approach
      * Time: O(n log n), Space: O(log n)
      */
-    static int divideAndConquer(const std::vector<int>& arr, int left, int right) {
+    static long long divideAndConquer(dsa::Span<const int> arr, long long left, long long right) {
+        // Measure the top-level call only
+        DSA_PERF_REGION_IF(left == 0 && right + 1 == static_cast<long long>(arr.size()),
+                           "max-subarray/divide-and-conquer", arr.size());
         if (left == right) {
             return arr[left];
         }
         
-        int mid = left + (right - left) / 2;
+        long long mid = left + (right - left) / 2;
         
         // Maximum subarray in left half
-        int leftSum = divideAndConquer(arr, left, mid);
+        long long leftSum = divideAndConquer(arr, left, mid);
         
         // Maximum subarray in right half
-        int rightSum = divideAndConquer(arr, mid + 1, right);
+        long long rightSum = divideAndConquer(arr, mid + 1, right);
         
         // Maximum subarray crossing the middle
-        int leftMax = INT_MIN;
-        int sum = 0;
-        for (int i = mid; i >= left; i--) {
+        long long leftMax = LLONG_MIN;
+        long long sum = 0;
+        for (long long i = mid; i >= left; i--) {
             sum += arr[i];
             leftMax = std::max(leftMax, sum);
         }
         
-        int rightMax = INT_MIN;
+        long long rightMax = LLONG_MIN;
         sum = 0;
-        for (int i = mid + 1; i <= right; i++) {
+        for (long long i = mid + 1; i <= right; i++) {
             sum += arr[i];
             rightMax = std::max(rightMax, sum);
         }
         
-        int crossSum = leftMax + rightMax;
+        long long crossSum = leftMax + rightMax;
         
         return std::max({leftSum, rightSum, crossSum});
     }
@@ -103,13 +121,14 @@ public:
      * Brute Force approach - O(n²)
      * Useful for understanding the problem
      */
-    static int bruteForce(const std::vector<int>& arr) {
+    static long long bruteForce(dsa::Span<const int> arr) {
         if (arr.empty()) return 0;
         
-        int maxSum = INT_MIN;
+        DSA_PERF_REGION("max-subarray/brute-force", arr.size());
+        long long maxSum = LLONG_MIN;
         
         for (size_t i = 0; i < arr.size(); i++) {
-            int currentSum = 0;
+            long long currentSum = 0;
             for (size_t j = i; j < arr.size(); j++) {
                 currentSum += arr[j];
                 maxSum = std::max(maxSum, currentSum);
@@ -123,19 +142,23 @@ public:
      * Prefix Sum approach
      * Time: O(n), Space: O(n)
      */
-    static int prefixSum(const std::vector<int>& arr) {
+    static long long prefixSum(dsa::Span<const int> arr) {
         if (arr.empty()) return 0;
         
-        std::vector<int> prefix(arr.size());
+        std::vector<long long> prefix(arr.size());
         prefix[0] = arr[0];
         
-        for (size_t i = 1; i < arr.size(); i++) {
-            prefix[i] = prefix[i-1] + arr[i];
+        {
+            DSA_PERF_REGION("max-subarray/prefix-sum/build", arr.size());
+            for (size_t i = 1; i < arr.size(); i++) {
+                prefix[i] = prefix[i-1] + arr[i];
+            }
         }
         
-        int maxSum = arr[0];
-        int minPrefix = 0;
+        long long maxSum = arr[0];
+        long long minPrefix = 0;
         
+        DSA_PERF_REGION("max-subarray/prefix-sum/scan", arr.size());
         for (size_t i = 0; i < prefix.size(); i++) {
             maxSum = std::max(maxSum, prefix[i] - minPrefix);
             minPrefix = std::min(minPrefix, prefix[i]);
@@ -155,14 +178,35 @@ void printArray(const std::vector<int>& arr) {
     std::cout << "]";
 }
 
-int main() {
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+#include "../datasets/dataset.h"
+
+// Usage: max_subarray [dataset.bin] - scans an Int32 dataset (see datasets/README.md)
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        // Read-only mapping; only the O(1)-space approaches run on full datasets
+        dsa::Dataset<const int> data;
+        if (!data.open(argv[1])) {
+            std::cerr << "Cannot load " << argv[1] << ": " << data.error() << std::endl;
+            return 1;
+        }
+        data.advise(MADV_SEQUENTIAL);
+        auto [maxSum, start, end] = MaxSubarray::kadaneWithIndices(data.elements());
+        std::cout << "Elements: " << data.size() << std::endl;
+        std::cout << "Kadane's Algorithm: " << MaxSubarray::kadane(data.elements()) << std::endl;
+        std::cout << "Subarray indices: [" << start << ", " << end << "], sum " << maxSum << std::endl;
+        return 0;
+    }
+
     // Test cases
     std::vector<std::vector<int>> testCases = {
         {-2, 1, -3, 4, -1, 2, 1, -5, 4},  // Expected: 6
         {1, 2, 3, 4, 5},                   // Expected: 15
         {-5, -2, -8, -1, -4},              // Expected: -1
         {5},                               // Expected: 5
-        {-1, -2, -3, -4}                   // Expected: -1
+        {-1, -2, -3, -4},                  // Expected: -1
+        {2000000000, 2000000000}           // Expected: 4000000000 (past INT_MAX)
     };
     
     for (size_t i = 0; i < testCases.size(); i++) {
@@ -170,10 +214,11 @@ int main() {
         printArray(testCases[i]);
         std::cout << std::endl;
         
-        int kadaneResult = MaxSubarray::kadane(testCases[i]);
-        int dcResult = MaxSubarray::divideAndConquer(testCases[i], 0, testCases[i].size() - 1);
-        int bfResult = MaxSubarray::bruteForce(testCases[i]);
-        int psResult = MaxSubarray::prefixSum(testCases[i]);
+        long long kadaneResult = MaxSubarray::kadane(testCases[i]);
+        long long last = static_cast<long long>(testCases[i].size()) - 1;
+        long long dcResult = MaxSubarray::divideAndConquer(testCases[i], 0, last);
+        long long bfResult = MaxSubarray::bruteForce(testCases[i]);
+        long long psResult = MaxSubarray::prefixSum(testCases[i]);
         
         auto [maxSum, start, end] = MaxSubarray::kadaneWithIndices(testCases[i]);
         
@@ -194,4 +239,5 @@ int main() {
     }
     
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN
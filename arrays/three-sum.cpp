@@ -1,8 +1,16 @@
 #include <iostream>
 #include <vector>
 #include <unordered_map>
+#include <climits>
+#include "../datasets/dataset-layout.h"
 using namespace std;
 
+// Profiling hooks (see benchmarks/perf-counters.h); no-ops unless that header is included first
+#ifndef DSA_PERF_REGION
+#define DSA_PERF_REGION(name, elements)
+#define DSA_PERF_REGION_IF(condition, name, elements)
+#endif
+
 /**
  * @brief Brute Force Approach (O(n^3))
  * 
@@ -11,8 +19,8 @@ using namespace std;
  * Time Complexity: O(n^3)
  * Space Complexity: O(1)
  */
-vector<int> threeSumBruteForce(const vector<int>& nums, int target) {
-    int n = nums.size();
+vector<long long> threeSumBruteForce(dsa::Span<const int> nums, int target) {
+    long long n = static_cast<long long>(nums.size()); // 64-bit: datasets may pass 2^31 elements
     
     // Need at least 3 elements
     if (n < 3) {
@@ -20,12 +28,14 @@ vector<int> threeSumBruteForce(const vector<int>& nums, int target) {
         return {};
     }
 
+    DSA_PERF_REGION("three-sum/brute-force", n);
     // Try all possible combinations of three different indices
-    for (int i = 0; i < n; ++i) {
-        for (int j = i + 1; j < n; ++j) {            // j starts after i to avoid duplicates
-            for (int k = j + 1; k < n; ++k) {        // k starts after j to avoid duplicates
+    for (long long i = 0; i < n; ++i) {
+        for (long long j = i + 1; j < n; ++j) {  // j starts after i to avoid duplicates
+            for (long long k = j + 1; k < n; ++k) {  // k starts after j to avoid duplicates
                 // Check if current triplet sums to target
-                if (nums[i] + nums[j] + nums[k] == target) {
+                // Summed in long long: three ints can overflow an int
+                if (static_cast<long long>(nums[i]) + nums[j] + nums[k] == target) {
                     return {i, j, k};                 // Return indices of the triplet
                 }
             }
@@ -40,12 +50,13 @@ vector<int> threeSumBruteForce(const vector<int>& nums, int target) {
  * 
  * For each element, reduce the problem to a Two Sum (target - nums[i]).
  * Use an unordered_map to store complements.
+ * Takes a Span, so vectors and memory-mapped datasets both work.
  * 
  * Time Complexity: O(n^2)
  * Space Complexity: O(n)
  */
-vector<int> threeSum(const vector<int>& nums, int target) {
-    int n = nums.size();
+vector<long long> threeSum(dsa::Span<const int> nums, int target) {
+    long long n = static_cast<long long>(nums.size()); // 64-bit: datasets may pass 2^31 elements
 
         // Need at least 3 elements
     if (n < 3) {
@@ -53,19 +64,22 @@ vector<int> threeSum(const vector<int>& nums, int target) {
         return {};
     }
 
+    DSA_PERF_REGION("three-sum/hash-loop", n);
     // Fix the first element and solve Two Sum for the remaining elements
-    for (int i = 0; i < n; ++i) {
-        unordered_map<int, int> seen; // Maps value to its index
-        int newTarget = target - nums[i];   // What the other two numbers should sum to
+    for (long long i = 0; i < n; ++i) {
+        unordered_map<int, long long> seen; // Maps value to its index
+        long long newTarget = static_cast<long long>(target) - nums[i]; // What the other two should sum to
         
         // Look for two numbers that sum to newTarget in the remaining array
-        for (int j = i + 1; j < n; ++j) {
-            int complement = newTarget - nums[j];  // What we need to complete the triplet
+        for (long long j = i + 1; j < n; ++j) {
+            long long complement = newTarget - nums[j]; // What we need to complete the triplet
             
-            // Check if we've seen the complement before
-            if (seen.count(complement)) {
-                // Found triplet: nums[i] + nums[seen[complement]] + nums[j] = target
-                return {i, seen[complement], j};
+            // Check if we've seen the complement before (it cannot be if it does not fit an int)
+            auto it = complement >= INT_MIN && complement <= INT_MAX ? seen.find(static_cast<int>(complement))
+                                                                      : seen.end();
+            if (it != seen.end()) {
+                // Found triplet: nums[i] + nums[it->second] + nums[j] = target
+                return {i, it->second, j};
             }
             
             // Store current number and its index for future lookups
@@ -77,8 +91,30 @@ vector<int> threeSum(const vector<int>& nums, int target) {
 }
 
 
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+#include <cstdlib>
+#include "../datasets/dataset.h"
+
 // --- Test Cases ---
-int main() {
+// Usage: three_sum [dataset.bin target] - searches an Int32 dataset (see datasets/README.md)
+int main(int argc, char* argv[]) {
+    if (argc > 2) {
+        dsa::Dataset<const int> data;
+        if (!data.open(argv[1])) {
+            cerr << "Cannot load " << argv[1] << ": " << data.error() << "\n";
+            return 1;
+        }
+        int target = atoi(argv[2]);
+        auto result = threeSum(data.elements(), target);
+        if (result.empty()) {
+            cout << "No triplet sums to " << target << "\n";
+        } else {
+            cout << "Indices: [" << result[0] << ", " << result[1] << ", " << result[2] << "]\n";
+        }
+        return 0;
+    }
+
     // Test Case 1: Basic positive numbers with valid triplet
     // Expected: indices where nums[i] + nums[j] + nums[k] = 20
     // Array: [2, 7, 11, 15, -2], Target: 20
@@ -117,5 +153,19 @@ int main() {
         cout << "Test 3 - No triplet found for target " << target3 << "\n";
     }
 
+    // Test Case 4: Sums past INT_MAX
+    // 2000000000 + 2000000000 + 0 wraps to -294967296 in int; no triplet really hits it
+    // 2000000000 + 2000000000 - 2000000000 = 2000000000 (indices 0, 1, 2)
+    vector<int> nums4 = {2000000000, 2000000000, 0};
+    auto result4 = threeSum(nums4, -294967296);
+    auto brute4 = threeSumBruteForce(nums4, -294967296);
+    cout << "Test 4 - Wrapped sum matched: " << (result4.empty() && brute4.empty() ? "No" : "Yes") << "\n";
+    vector<int> nums5 = {2000000000, 2000000000, -2000000000};
+    auto result5 = threeSum(nums5, 2000000000);
+    if (!result5.empty()) {
+        cout << "Test 4 - Optimal: [" << result5[0] << ", " << result5[1] << ", " << result5[2] << "]\n";
+    }
+
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+// Replaces the global operator new / delete with counting versions
+#include "alloc-tracker.h"
+
+// Reuse the algorithms without pulling in their demo main() functions
+#define DSA_NO_MAIN
+#include "../sorting/merge-sort.cpp"
+#include "../arrays/max-subarray.cpp"
+#include "../arrays/three-sum.cpp"
+#include "../strings/reverse-string.cpp"
+#include "../greedy-algorithms/huffman-coding.cpp"
+
+/**
+ * Per-Call Heap Traffic Report
+ *
+ * Prints, for single calls of the allocating hot paths, how many heap
+ * allocations they make, how many bytes they request and how much memory
+ * is live at their peak. Then checks the paths that should not allocate
+ * at all.
+ *
+ * Usage: alloc-report [n]   (default n = 100000)
+ * Build: g++ -std=c++17 -O2 alloc-report.cpp -o alloc-report
+ */
+
+// Swallows huffmanCoding's code table
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+void printRow(const std::string& call, size_t n, const alloc::Stats& s) {
+    std::cout << std::left << std::setw(44) << call << std::right << std::setw(10) << n
+              << std::setw(12) << s.count << std::setw(14) << s.bytes << std::setw(14) << s.peak
+              << std::fixed << std::setprecision(2) << std::setw(12)
+              << (n ? static_cast<double>(s.bytes) / n : 0.0) << "\n";
+}
+
+std::vector<int> randomInts(size_t n, int lo, int hi, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(lo, hi);
+    std::vector<int> v(n);
+    for (auto& x : v) x = dist(rng);
+    return v;
+}
+
+std::string randomText(size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::string s(n, ' ');
+    for (auto& c : s) {
+        c = (rng() % 6 == 0) ? ' ' : static_cast<char>('a' + rng() % 26);
+    }
+    return s;
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    if (n < 16) {
+        std::cerr << "Usage: alloc-report [n >= 16]\n";
+        return 1;
+    }
+
+    std::cout << "--- Heap traffic per call ---\n";
+    std::cout << std::left << std::setw(44) << "call" << std::right << std::setw(10) << "n"
+              << std::setw(12) << "allocs" << std::setw(14) << "bytes" << std::setw(14) << "peak live"
+              << std::setw(12) << "bytes/elem" << "\n";
+
+    // merge(): one call on two sorted halves -> the L and R temporaries
+    std::vector<int> arr = randomInts(n, -1000000, 1000000, 1);
+    int mid = static_cast<int>(n / 2) - 1;
+    std::sort(arr.begin(), arr.begin() + mid + 1);
+    std::sort(arr.begin() + mid + 1, arr.end());
+    printRow("merge (top level)", n, alloc::measure([&] { merge(arr, 0, mid, static_cast<int>(n) - 1); }));
+
+    // mergeSort(): two temporaries per merge, n - 1 merges
+    arr = randomInts(n, -1000000, 1000000, 2);
+    printRow("mergeSort", n, alloc::measure([&] { mergeSort(arr, 0, static_cast<int>(n) - 1); }));
+
+    std::string text = randomText(n, 3);
+    printRow("StringReversal::reverseUsingStack", n, alloc::measure([&] {
+        std::string r = StringReversal::reverseUsingStack(text);
+    }));
+
+    // O(n^2) bytes and n-deep recursion, so a shorter string
+    size_t shortLength = std::min<size_t>(n, 5000);
+    std::string shortText = text.substr(0, shortLength);
+    printRow("StringReversal::reverseRecursive", shortLength, alloc::measure([&] {
+        std::string r = StringReversal::reverseRecursive(shortText);
+    }));
+
+    printRow("StringReversal::reverseWords", n, alloc::measure([&] {
+        std::string r = StringReversal::reverseWords(text);
+    }));
+
+    size_t symbols = std::min<size_t>(n, 100000);
+    std::vector<int> freq = randomInts(symbols, 1, 10000, 4);
+    std::vector<char> data(symbols);
+    for (size_t i = 0; i < symbols; i++) {
+        data[i] = static_cast<char>('a' + i % 26);
+    }
+    NullBuffer null;
+    std::streambuf* saved = std::cout.rdbuf(&null);
+    alloc::Stats huffman = alloc::measure([&] { huffmanCoding(data, freq); });
+    std::cout.rdbuf(saved);
+    printRow("huffmanCoding", symbols, huffman);
+
+    // Unreachable target: every i builds (and frees) its own unordered_map
+    size_t tripletN = std::min<size_t>(n, 2000);
+    std::vector<int> nums = randomInts(tripletN, -100000, 100000, 5);
+    printRow("threeSum (no solution)", tripletN, alloc::measure([&] { threeSum(nums, 1000000); }));
+
+    std::vector<int> values = randomInts(n, -10, 10, 6);
+    printRow("MaxSubarray::prefixSum", n, alloc::measure([&] { MaxSubarray::prefixSum(values); }));
+
+    std::cout << "\n--- Zero-allocation paths ---\n";
+    long long best = 0;
+    bool palindrome = false;
+    bool ok = true;
+    ok &= alloc::expectNoAllocations("MaxSubarray::kadane", [&] { best = MaxSubarray::kadane(values); });
+    ok &= alloc::expectNoAllocations("StringReversal::isPalindromeOptimal", [&] {
+        palindrome = StringReversal::isPalindromeOptimal(text);
+    });
+    ok &= alloc::expectNoAllocations("StringReversal::reverseCharArray", [&] {
+        StringReversal::reverseCharArray(&text[0], static_cast<int>(text.size()));
+    });
+    // Taking the string by value costs nothing when the caller moves it in
+    ok &= alloc::expectNoAllocations("StringReversal::reverseTwoPointer (moved in)", [&] {
+        text = StringReversal::reverseTwoPointer(std::move(text));
+    });
+    DSA_ASSERT_NO_ALLOC(best = std::max(best, MaxSubarray::kadane(values)));
+    std::cout << "All zero-allocation paths allocate nothing: " << (ok ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- The check catches allocating paths ---\n";
+    bool copyIsFree = alloc::expectNoAllocations("StringReversal::reverseTwoPointer (copied in)", [&] {
+        std::string r = StringReversal::reverseTwoPointer(text);
+    });
+    std::cout << "Copying into reverseTwoPointer reported as allocation-free: "
+              << (copyIsFree ? "Yes" : "No") << " (expected No)\n";
+    std::cout << "(checksum " << best + palindrome << ")\n";
+    return ok && !copyIsFree ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+#ifndef DSA_ALLOC_TRACKER_H
+#define DSA_ALLOC_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+/**
+ * Allocation Accounting
+ *
+ * Several hot paths allocate on every call without it being visible in
+ * the code: the L/R vectors in merge(), the std::stack in
+ * reverseUsingStack, substr() in reverseRecursive, the make_shared nodes
+ * in huffmanCoding, the per-i unordered_map in threeSum.
+ *
+ * Including this header replaces the global operator new / delete (all
+ * forms, including the C++17 aligned ones) with versions that count:
+ * - allocations and bytes requested
+ * - live bytes, and the peak of live bytes
+ *
+ * alloc::Scope reads those counters for a stretch of code. Scopes nest:
+ * the peak is tracked separately for each scope, relative to what was
+ * live when it started. expectNoAllocations() and DSA_ASSERT_NO_ALLOC
+ * check that a path which should not allocate really does not.
+ *
+ * Tracking is opt-in: only programs that include this header pay for it.
+ * Replacement operators must be defined exactly once, so include it from
+ * a single translation unit (every driver here is one file).
+ * Counters are atomic, so threads may allocate, but a Scope also sees
+ * allocations made by other threads while it is open.
+ */
+
+namespace alloc {
+
+struct Stats {
+    uint64_t count = 0; // allocations
+    uint64_t bytes = 0; // bytes requested
+    uint64_t peak = 0;  // peak live bytes above the starting level
+};
+
+namespace detail {
+
+inline std::atomic<uint64_t> count{0};
+inline std::atomic<uint64_t> bytes{0};
+inline std::atomic<uint64_t> live{0};
+inline std::atomic<uint64_t> peak{0};
+
+inline void raisePeak(uint64_t value) {
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+// Every block carries a 16-byte (or `align`-byte) header right before the
+// user pointer: [..., size, base]. That makes frees exact even when the
+// unsized operator delete is called.
+inline void* allocate(std::size_t size, std::size_t align) {
+    std::size_t header = align < 16 ? 16 : align;
+    void* base;
+    if (align <= alignof(std::max_align_t)) {
+        base = std::malloc(header + size);
+    } else {
+        std::size_t total = (header + size + align - 1) / align * align;
+        base = std::aligned_alloc(align, total);
+    }
+    if (!base) {
+        return nullptr;
+    }
+    char* user = static_cast<char*>(base) + header;
+    reinterpret_cast<std::size_t*>(user)[-2] = size;
+    reinterpret_cast<void**>(user)[-1] = base;
+
+    count.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    raisePeak(live.fetch_add(size, std::memory_order_relaxed) + size);
+    return user;
+}
+
+inline void release(void* p) {
+    if (!p) {
+        return;
+    }
+    char* user = static_cast<char*>(p);
+    live.fetch_sub(reinterpret_cast<std::size_t*>(user)[-2], std::memory_order_relaxed);
+    std::free(reinterpret_cast<void**>(user)[-1]);
+}
+
+inline void* allocateOrThrow(std::size_t size, std::size_t align) {
+    void* p = allocate(size, align);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+} // namespace detail
+
+// Counts everything allocated between construction and stats()
+class Scope {
+public:
+    Scope()
+        : count_(detail::count.load(std::memory_order_relaxed)),
+          bytes_(detail::bytes.load(std::memory_order_relaxed)),
+          live_(detail::live.load(std::memory_order_relaxed)),
+          outerPeak_(detail::peak.exchange(live_, std::memory_order_relaxed)) {}
+
+    // Hands the scope's peak back to any enclosing scope
+    ~Scope() { detail::raisePeak(outerPeak_); }
+
+    Stats stats() const {
+        Stats s;
+        s.count = detail::count.load(std::memory_order_relaxed) - count_;
+        s.bytes = detail::bytes.load(std::memory_order_relaxed) - bytes_;
+        s.peak = detail::peak.load(std::memory_order_relaxed) - live_;
+        return s;
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    uint64_t count_, bytes_, live_, outerPeak_;
+};
+
+// Runs fn() and returns what it allocated
+template <typename Fn>
+Stats measure(Fn&& fn) {
+    Scope scope;
+    fn();
+    return scope.stats();
+}
+
+// True if fn() allocates nothing; otherwise reports what it did allocate
+template <typename Fn>
+bool expectNoAllocations(const char* what, Fn&& fn) {
+    Stats s = measure(fn);
+    if (s.count != 0) {
+        std::cerr << what << ": expected no allocations, got " << s.count << " (" << s.bytes << " bytes)\n";
+    }
+    return s.count == 0;
+}
+
+} // namespace alloc
+
+// Aborts if `statement` allocates (for paths that must stay allocation-free)
+#define DSA_ASSERT_NO_ALLOC(statement)                                          \
+    do {                                                                        \
+        if (!alloc::expectNoAllocations(#statement, [&] { statement; })) {      \
+            std::abort();                                                       \
+        }                                                                       \
+    } while (0)
+
+// --- Global replacements (not inline, by definition of a replacement) ---
+
+void* operator new(std::size_t size) { return alloc::detail::allocateOrThrow(size, 0); }
+void* operator new[](std::size_t size) { return alloc::detail::allocateOrThrow(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return alloc::detail::allocate(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return alloc::detail::allocate(size, 0); }
+void* operator new(std::size_t size, std::align_val_t align) {
+    return alloc::detail::allocateOrThrow(size, static_cast<std::size_t>(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return alloc::detail::allocateOrThrow(size, static_cast<std::size_t>(align));
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return alloc::detail::allocate(size, static_cast<std::size_t>(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return alloc::detail::allocate(size, static_cast<std::size_t>(align));
+}
+
+void operator delete(void* p) noexcept { alloc::detail::release(p); }
+void operator delete[](void* p) noexcept { alloc::detail::release(p); }
+void operator delete(void* p, std::size_t) noexcept { alloc::detail::release(p); }
+void operator delete[](void* p, std::size_t) noexcept { alloc::detail::release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { alloc::detail::release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { alloc::detail::release(p); }
+void operator delete(void* p, std::align_val_t) noexcept { alloc::detail::release(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { alloc::detail::release(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alloc::detail::release(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alloc::detail::release(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { alloc::detail::release(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { alloc::detail::release(p); }
+
+#endif // DSA_ALLOC_TRACKER_H
@@ -0,0 +1,955 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <map>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <thread>
+#include <unistd.h>
+
+// Reuse every algorithm without pulling in the demo main() functions
+#define DSA_NO_MAIN
+#include "../sorting/merge-sort.cpp"
+#include "../arrays/max-subarray.cpp"
+#include "../arrays/three-sum.cpp"
+#include "../strings/reverse-string.cpp"
+#include "../greedy-algorithms/huffman-coding.cpp"
+#include "../greedy-algorithms/fractional-knapsack.cpp"
+#include "../greedy-algorithms/job-sequencing.cpp"
+#include "../greedy-algorithms/activity-selection.cpp"
+#include "../greedy-algorithms/huffman-frequency-count.cpp"
+#include "../greedy-algorithms/fractional-knapsack-select.cpp"
+#include "../greedy-algorithms/fractional-knapsack-index.cpp"
+#include "../greedy-algorithms/fractional-knapsack-dynamic.cpp"
+#include "../greedy-algorithms/knapsack-01.cpp"
+#include "../greedy-algorithms/job-sequencing-dsu.cpp"
+#include "../greedy-algorithms/job-sequencing-online.cpp"
+#include "../greedy-algorithms/activity-selection-soa.cpp"
+#include "../greedy-algorithms/interval-partitioning.cpp"
+#include "../greedy-algorithms/weighted-interval-scheduling.cpp"
+
+/**
+ * Micro-Benchmark Suite
+ *
+ * Times every algorithm variant of the repo on the same seeded inputs:
+ * 1. Generate the input for (benchmark, pattern, size) from a fixed seed
+ * 2. Run a few warmup iterations, then timed repetitions. In-place
+ *    algorithms get a fresh copy of the input before every run, outside
+ *    the timed region
+ * 3. Summarize with median and MAD (median absolute deviation), which a
+ *    few preempted runs cannot drag around the way mean and stddev can
+ * 4. Sweep sizes by powers of ten from 10^3 to 10^9, skipping sizes that
+ *    exceed the benchmark's own cap, the memory budget (--max-bytes) or
+ *    the time budget (--max-seconds, extrapolated from smaller sizes)
+ *
+ * Patterns: random, sorted, reversed, skewed (90% of values from a small
+ * hot set) and adversarial (alternating extremes, palindromic strings,
+ * unreachable three-sum targets).
+ *
+ * Results go to stdout as a table and, with --json, to a file holding
+ * one result per line. --compare reads two such files and flags a case
+ * only when its median got slower by more than the threshold and its
+ * [min, max] range no longer overlaps the base run's (every new run is
+ * slower than every base run); the exit status is 1 if any case
+ * regressed. --self-test checks that rule on synthetic files.
+ *
+ * Build: g++ -std=c++17 -O2 benchmark-suite.cpp -o benchmark-suite
+ */
+
+namespace bench {
+
+enum class Pattern { Random, Sorted, Reversed, Skewed, Adversarial };
+
+const std::vector<std::pair<Pattern, const char*>> kPatterns = {
+    {Pattern::Random, "random"},
+    {Pattern::Sorted, "sorted"},
+    {Pattern::Reversed, "reversed"},
+    {Pattern::Skewed, "skewed"},
+    {Pattern::Adversarial, "adversarial"}
+};
+
+// ---------------------------------------------------------------------------
+// Input generators
+// ---------------------------------------------------------------------------
+
+// n values in [lo, hi] arranged according to the pattern
+std::vector<int> makeInts(Pattern pattern, size_t n, int lo, int hi, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> uniform(lo, hi);
+    std::vector<int> v(n);
+
+    switch (pattern) {
+    case Pattern::Random:
+        for (auto& x : v) x = uniform(rng);
+        break;
+    case Pattern::Sorted:
+    case Pattern::Reversed:
+        for (auto& x : v) x = uniform(rng);
+        std::sort(v.begin(), v.end());
+        if (pattern == Pattern::Reversed) {
+            std::reverse(v.begin(), v.end());
+        }
+        break;
+    case Pattern::Skewed: {
+        int hot[8];
+        for (auto& h : hot) h = uniform(rng);
+        for (auto& x : v) {
+            x = (rng() % 10 != 0) ? hot[rng() % 8] : uniform(rng);
+        }
+        break;
+    }
+    case Pattern::Adversarial:
+        // lo, hi, lo+1, hi-1, ... : every neighbour pair is a worst-case swing
+        for (size_t i = 0; i < n; i++) {
+            long long range = static_cast<long long>(hi) - lo;
+            int step = static_cast<int>(static_cast<long long>(i / 2) % (range / 2 + 1));
+            v[i] = (i % 2 == 0) ? lo + step : hi - step;
+        }
+        break;
+    }
+    return v;
+}
+
+// Letters and spaces; adversarial strings are palindromes (full scans everywhere)
+std::string makeString(Pattern pattern, size_t n, uint64_t seed) {
+    std::vector<int> v = makeInts(pattern == Pattern::Adversarial ? Pattern::Random : pattern,
+                                  n, 0, 26 * 6 - 1, seed);
+    std::string s(n, ' ');
+    for (size_t i = 0; i < n; i++) {
+        s[i] = (v[i] % 6 == 0) ? ' ' : static_cast<char>('a' + v[i] / 6);
+    }
+    if (pattern == Pattern::Adversarial) {
+        std::copy(s.begin(), s.begin() + n / 2, s.rbegin());
+    }
+    return s;
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark registry
+// ---------------------------------------------------------------------------
+
+// One prepared input. reset() runs untimed before every run(); run()
+// returns a checksum so the optimizer cannot drop the work.
+struct Case {
+    std::function<void()> reset = [] {};
+    std::function<long long()> run;
+};
+
+struct Benchmark {
+    std::string name;
+    size_t maxSize;         // hard cap (quadratic algorithms, recursion depth)
+    size_t bytesPerElement; // rough peak memory per element, for --max-bytes
+    std::function<Case(Pattern, size_t, uint64_t)> make;
+    double growth = 1.0;    // expected time exponent, until two sizes have been measured
+};
+
+// Swallows everything written to it; used to silence the printing algorithms
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// Redirects std::cout to a NullBuffer for its lifetime
+class QuietCout {
+public:
+    QuietCout() : saved_(std::cout.rdbuf(&sink_)) {}
+    ~QuietCout() { std::cout.rdbuf(saved_); }
+
+private:
+    NullBuffer sink_;
+    std::streambuf* saved_;
+};
+
+// Input shared by a case's reset() and run(), plus the working copy
+template <typename T>
+struct Inputs {
+    T original;
+    T work;
+};
+
+// Benchmark over a read-only int vector
+Benchmark intBenchmark(const std::string& name, size_t maxSize, int lo, int hi,
+                       std::function<long long(const std::vector<int>&)> fn) {
+    return {name, maxSize, 8, [=](Pattern p, size_t n, uint64_t seed) {
+        auto data = std::make_shared<std::vector<int>>(makeInts(p, n, lo, hi, seed));
+        Case c;
+        c.run = [data, fn] { return fn(*data); };
+        return c;
+    }};
+}
+
+// Benchmark over a read-only string
+Benchmark stringBenchmark(const std::string& name, size_t maxSize,
+                          std::function<long long(const std::string&)> fn) {
+    return {name, maxSize, 4, [=](Pattern p, size_t n, uint64_t seed) {
+        auto data = std::make_shared<std::string>(makeString(p, n, seed));
+        Case c;
+        c.run = [data, fn] { return fn(*data); };
+        return c;
+    }};
+}
+
+// Three-sum inputs stay in [-kThreeSumBound, kThreeSumBound] so no sum overflows
+const int kThreeSumBound = 100000000;
+
+// Three-sum target: unreachable for the adversarial pattern (full search),
+// otherwise the sum of the last three values (found late in the scan)
+int threeSumTarget(Pattern p, const std::vector<int>& v) {
+    if (p == Pattern::Adversarial || v.size() < 3) {
+        return 3 * kThreeSumBound + 1;
+    }
+    size_t n = v.size();
+    return v[n - 1] + v[n - 2] + v[n - 3];
+}
+
+// Knapsack items: values follow the pattern, weights in [1, 100];
+// the capacity is half the total weight
+std::vector<Item> makeItems(Pattern p, size_t n, uint64_t seed, int& capacity) {
+    std::vector<int> values = makeInts(p, n, 1, 1000, seed);
+    std::vector<int> weights = makeInts(Pattern::Random, n, 1, 100, seed + 1);
+    std::vector<Item> items(n);
+    long long totalWeight = 0;
+    for (size_t i = 0; i < n; i++) {
+        items[i] = {values[i], weights[i], 0.0};
+        totalWeight += weights[i];
+    }
+    capacity = static_cast<int>(std::min<long long>(totalWeight / 2, INT_MAX));
+    return items;
+}
+
+// Jobs: deadlines follow the pattern, up to min(n, 1000); profits in [1, 1000]
+std::vector<Job> makeJobs(Pattern p, size_t n, uint64_t seed) {
+    int maxDeadline = static_cast<int>(std::min<size_t>(n, 1000));
+    std::vector<int> deadlines = makeInts(p, n, 1, maxDeadline, seed);
+    std::vector<int> profits = makeInts(Pattern::Random, n, 1, 1000, seed + 1);
+    std::vector<Job> jobs(n);
+    for (size_t i = 0; i < n; i++) {
+        jobs[i] = {static_cast<char>('A' + i % 26), deadlines[i], profits[i]};
+    }
+    return jobs;
+}
+
+// Activities: starts follow the pattern over a horizon of 10n, lengths in [1, 100]
+std::vector<Activity> makeActivities(Pattern p, size_t n, uint64_t seed) {
+    int horizon = static_cast<int>(std::min<size_t>(n * 10, 2000000000));
+    std::vector<int> starts = makeInts(p, n, 0, horizon, seed);
+    std::vector<int> lengths = makeInts(Pattern::Random, n, 1, 100, seed + 1);
+    std::vector<Activity> activities(n);
+    for (size_t i = 0; i < n; i++) {
+        activities[i] = {starts[i], starts[i] + lengths[i]};
+    }
+    return activities;
+}
+
+std::vector<Benchmark> registry() {
+    std::vector<Benchmark> list;
+
+    // --- sorting/merge-sort.cpp ---
+    list.push_back({"mergeSort", SIZE_MAX, 16, [](Pattern p, size_t n, uint64_t seed) {
+        auto in = std::make_shared<Inputs<std::vector<int>>>();
+        in->original = makeInts(p, n, -1000000000, 1000000000, seed);
+        Case c;
+        c.reset = [in] { in->work = in->original; };
+        c.run = [in] {
+            if (!in->work.empty()) {
+                mergeSort(in->work, 0, static_cast<int>(in->work.size()) - 1);
+            }
+            return in->work.empty() ? 0LL : static_cast<long long>(in->work[in->work.size() / 2]);
+        };
+        return c;
+    }});
+
+    // --- arrays/max-subarray.cpp --- (values in [-10, 10])
+    list.push_back(intBenchmark("MaxSubarray::kadane", SIZE_MAX, -10, 10,
+        [](const std::vector<int>& v) { return static_cast<long long>(MaxSubarray::kadane(v)); }));
+    list.push_back(intBenchmark("MaxSubarray::kadaneWithIndices", SIZE_MAX, -10, 10,
+        [](const std::vector<int>& v) {
+            return static_cast<long long>(std::get<0>(MaxSubarray::kadaneWithIndices(v)));
+        }));
+    list.push_back(intBenchmark("MaxSubarray::divideAndConquer", SIZE_MAX, -10, 10,
+        [](const std::vector<int>& v) {
+            return v.empty() ? 0LL : static_cast<long long>(
+                MaxSubarray::divideAndConquer(v, 0, static_cast<long long>(v.size()) - 1));
+        }));
+    list.push_back(intBenchmark("MaxSubarray::prefixSum", SIZE_MAX, -10, 10,
+        [](const std::vector<int>& v) { return static_cast<long long>(MaxSubarray::prefixSum(v)); }));
+    list.back().bytesPerElement = 12; // the input plus a long long prefix array
+    list.push_back(intBenchmark("MaxSubarray::bruteForce", 100000, -10, 10,
+        [](const std::vector<int>& v) { return static_cast<long long>(MaxSubarray::bruteForce(v)); }));
+    list.back().growth = 2.0;
+
+    // --- arrays/three-sum.cpp ---
+    for (bool brute : {false, true}) {
+        std::string name = brute ? "threeSumBruteForce" : "threeSum";
+        list.push_back({name, brute ? 2000u : 20000u, 8, [brute](Pattern p, size_t n, uint64_t seed) {
+            auto data = std::make_shared<std::vector<int>>(makeInts(p, n, -kThreeSumBound, kThreeSumBound, seed));
+            int target = threeSumTarget(p, *data);
+            Case c;
+            c.run = [data, target, brute] {
+                std::vector<long long> r = brute ? threeSumBruteForce(*data, target) : threeSum(*data, target);
+                return static_cast<long long>(r.size());
+            };
+            return c;
+        }});
+        list.back().growth = brute ? 3.0 : 2.0;
+    }
+
+    // --- strings/reverse-string.cpp ---
+    list.push_back(stringBenchmark("StringReversal::reverseTwoPointer", SIZE_MAX,
+        [](const std::string& s) { return static_cast<long long>(StringReversal::reverseTwoPointer(s)[0]); }));
+    list.push_back(stringBenchmark("StringReversal::reverseUsingStack", SIZE_MAX,
+        [](const std::string& s) { return static_cast<long long>(StringReversal::reverseUsingStack(s)[0]); }));
+    list.push_back(stringBenchmark("StringReversal::reverseRecursive", 10000, // O(n^2), n-deep recursion
+        [](const std::string& s) { return static_cast<long long>(StringReversal::reverseRecursive(s)[0]); }));
+    list.back().growth = 2.0;
+    list.push_back(stringBenchmark("StringReversal::reverseSTL", SIZE_MAX,
+        [](const std::string& s) { return static_cast<long long>(StringReversal::reverseSTL(s)[0]); }));
+    list.push_back(stringBenchmark("StringReversal::reverseWords", SIZE_MAX,
+        [](const std::string& s) { return static_cast<long long>(StringReversal::reverseWords(s).size()); }));
+    list.push_back(stringBenchmark("StringReversal::isPalindromeOptimal", SIZE_MAX,
+        [](const std::string& s) { return static_cast<long long>(StringReversal::isPalindromeOptimal(s)); }));
+
+    // --- greedy-algorithms/huffman-coding.cpp ---
+    list.push_back({"huffmanCoding", SIZE_MAX, 200, [](Pattern p, size_t n, uint64_t seed) {
+        // Frequencies small enough that the root's total still fits in int
+        int maxFreq = static_cast<int>(std::max<size_t>(1, std::min<size_t>(1000000, 2000000000 / n)));
+        auto freq = std::make_shared<std::vector<int>>(makeInts(p, n, 1, maxFreq, seed));
+        auto data = std::make_shared<std::vector<char>>(n);
+        for (size_t i = 0; i < n; i++) {
+            (*data)[i] = static_cast<char>('a' + i % 26); // labels only, never '$'
+        }
+        Case c;
+        c.run = [data, freq] {
+            QuietCout quiet;
+            huffmanCoding(*data, *freq);
+            return static_cast<long long>(data->size());
+        };
+        return c;
+    }});
+
+    // --- greedy-algorithms/huffman-frequency-count.cpp --- (the counting stage in front of huffmanCoding)
+    const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int variant = 0; variant < 3; variant++) {
+        static const char* names[] = {"ByteHistogram::countNaive", "ByteHistogram::countInterleaved",
+                                      "ByteHistogram::countParallel"};
+        list.push_back({names[variant], SIZE_MAX, 5, [variant, hardwareThreads](Pattern p, size_t n, uint64_t seed) {
+            std::vector<int> values = makeInts(p, n, 0, 255, seed);
+            auto bytes = std::make_shared<std::vector<unsigned char>>(values.begin(), values.end());
+            Case c;
+            c.run = [bytes, variant, hardwareThreads] {
+                const unsigned char* b = bytes->data();
+                size_t size = bytes->size();
+                ByteCounts counts = variant == 0 ? ByteHistogram::countNaive(b, size)
+                                  : variant == 1 ? ByteHistogram::countInterleaved(b, size)
+                                                 : ByteHistogram::countParallel(b, size, hardwareThreads);
+                return static_cast<long long>(counts[b[0]]);
+            };
+            return c;
+        }});
+    }
+
+    // --- greedy-algorithms/fractional-knapsack.cpp ---
+    list.push_back({"fractionalKnapsack", SIZE_MAX, 48, [](Pattern p, size_t n, uint64_t seed) {
+        auto in = std::make_shared<Inputs<std::vector<Item>>>();
+        int capacity = 0;
+        in->original = makeItems(p, n, seed, capacity);
+        Case c;
+        c.reset = [in] { in->work = in->original; };
+        c.run = [in, capacity] { return static_cast<long long>(fractionalKnapsack(capacity, in->work)); };
+        return c;
+    }});
+
+    // --- greedy-algorithms/fractional-knapsack-{select,index,dynamic}.cpp --- (same items and capacity)
+    list.push_back({"FractionalKnapsackSelect::solve", SIZE_MAX, 56, [](Pattern p, size_t n, uint64_t seed) {
+        int capacity = 0;
+        auto items = std::make_shared<std::vector<Item>>(makeItems(p, n, seed, capacity));
+        Case c;
+        c.run = [items, capacity] {
+            return static_cast<long long>(FractionalKnapsackSelect::solve(capacity, *items));
+        };
+        return c;
+    }});
+    list.push_back({"FractionalKnapsackIndex::build", SIZE_MAX, 64, [](Pattern p, size_t n, uint64_t seed) {
+        // Builds the index, then answers one query
+        int capacity = 0;
+        auto items = std::make_shared<std::vector<Item>>(makeItems(p, n, seed, capacity));
+        Case c;
+        c.run = [items, capacity] {
+            FractionalKnapsackIndex index(*items);
+            return static_cast<long long>(index.query(capacity));
+        };
+        return c;
+    }});
+    list.push_back({"FractionalKnapsackIndex::queryBatch", SIZE_MAX, 80, [](Pattern p, size_t n, uint64_t seed) {
+        // n capacities against a prebuilt index of n items
+        int capacity = 0;
+        std::vector<Item> items = makeItems(p, n, seed, capacity);
+        auto index = std::make_shared<FractionalKnapsackIndex>(items);
+        std::vector<int> caps = makeInts(Pattern::Random, n, 0, 2 * capacity, seed + 2);
+        auto capacities = std::make_shared<std::vector<long long>>(caps.begin(), caps.end());
+        Case c;
+        c.run = [index, capacities] {
+            std::vector<double> answers = index->queryBatch(*capacities);
+            return static_cast<long long>(answers.back());
+        };
+        return c;
+    }});
+    list.push_back({"DynamicFractionalKnapsack::insert", SIZE_MAX, 80, [](Pattern p, size_t n, uint64_t seed) {
+        // Inserts all n items, then answers one query
+        int capacity = 0;
+        auto items = std::make_shared<std::vector<Item>>(makeItems(p, n, seed, capacity));
+        Case c;
+        c.run = [items, capacity] {
+            DynamicFractionalKnapsack knapsack;
+            for (const Item& item : *items) {
+                knapsack.insert(item);
+            }
+            return static_cast<long long>(knapsack.query(capacity));
+        };
+        return c;
+    }});
+
+    // --- greedy-algorithms/knapsack-01.cpp --- (n is the capacity; 40 items of weight up to n / 4)
+    for (int variant = 0; variant < 3; variant++) {
+        static const char* names[] = {"textbookKnapsack", "ZeroOneKnapsack::maxValue",
+                                      "ZeroOneKnapsack::bestSubsetSum"};
+        list.push_back({names[variant], 100000000, 8, [variant](Pattern p, size_t n, uint64_t seed) {
+            int capacity = static_cast<int>(n);
+            std::vector<int> values = makeInts(p, 40, 1, 100000, seed);
+            auto weights = std::make_shared<std::vector<int>>(
+                makeInts(Pattern::Random, 40, 1, std::max(1, capacity / 4), seed + 1));
+            auto items = std::make_shared<std::vector<Item>>(40);
+            for (size_t i = 0; i < 40; i++) {
+                (*items)[i] = {values[i], (*weights)[i], 0.0};
+            }
+            Case c;
+            c.run = [items, weights, capacity, variant] {
+                return variant == 0 ? textbookKnapsack(*items, capacity)
+                     : variant == 1 ? ZeroOneKnapsack::maxValue(*items, capacity)
+                                    : static_cast<long long>(ZeroOneKnapsack::bestSubsetSum(*weights, capacity));
+            };
+            return c;
+        }});
+    }
+
+    // --- greedy-algorithms/job-sequencing.cpp --- (O(n * maxDeadline); deadlines up to 1000)
+    list.push_back({"jobSequencing", SIZE_MAX, 24, [](Pattern p, size_t n, uint64_t seed) {
+        auto in = std::make_shared<Inputs<std::vector<Job>>>();
+        in->original = makeJobs(p, n, seed);
+        Case c;
+        c.reset = [in] { in->work = in->original; };
+        c.run = [in] {
+            QuietCout quiet;
+            jobSequencing(in->work);
+            return static_cast<long long>(in->work.size());
+        };
+        return c;
+    }});
+
+    // --- greedy-algorithms/job-sequencing-{dsu,online}.cpp --- (same jobs)
+    list.push_back({"JobScheduler::schedule", SIZE_MAX, 40, [](Pattern p, size_t n, uint64_t seed) {
+        auto jobs = std::make_shared<std::vector<Job>>(makeJobs(p, n, seed));
+        Case c;
+        c.run = [jobs] { return JobScheduler::schedule(*jobs).totalProfit; };
+        return c;
+    }});
+    list.push_back({"OnlineJobScheduler::insert", SIZE_MAX, 200, [](Pattern p, size_t n, uint64_t seed) {
+        auto jobs = std::make_shared<std::vector<Job>>(makeJobs(p, n, seed));
+        Case c;
+        c.run = [jobs] {
+            OnlineJobScheduler scheduler(1000); // the largest deadline makeJobs produces
+            for (const Job& job : *jobs) {
+                scheduler.insert(job.deadline, job.profit);
+            }
+            return scheduler.totalProfit();
+        };
+        return c;
+    }});
+
+    // --- greedy-algorithms/activity-selection.cpp ---
+    list.push_back({"selectActivities", SIZE_MAX, 24, [](Pattern p, size_t n, uint64_t seed) {
+        auto in = std::make_shared<Inputs<std::vector<Activity>>>();
+        in->original = makeActivities(p, n, seed);
+        Case c;
+        c.reset = [in] { in->work = in->original; };
+        c.run = [in] {
+            QuietCout quiet;
+            selectActivities(in->work);
+            return static_cast<long long>(in->work.size());
+        };
+        return c;
+    }});
+
+    // --- greedy-algorithms/activity-selection-soa.cpp, interval-partitioning.cpp,
+    //     weighted-interval-scheduling.cpp --- (same activities)
+    list.push_back({"ActivitySelector::select", SIZE_MAX, 32, [](Pattern p, size_t n, uint64_t seed) {
+        std::vector<Activity> activities = makeActivities(p, n, seed);
+        auto start = std::make_shared<std::vector<int>>();
+        auto finish = std::make_shared<std::vector<int>>();
+        ActivitySelector::toArrays(activities, *start, *finish);
+        auto selected = std::make_shared<std::vector<uint32_t>>(n);
+        auto selector = std::make_shared<ActivitySelector>(); // scratch is reused across runs
+        Case c;
+        c.run = [start, finish, selected, selector] {
+            return static_cast<long long>(
+                selector->select(start->data(), finish->data(), start->size(), selected->data()));
+        };
+        return c;
+    }});
+    list.push_back({"IntervalPartitioner::minResources", SIZE_MAX, 48, [](Pattern p, size_t n, uint64_t seed) {
+        auto activities = std::make_shared<std::vector<Activity>>(makeActivities(p, n, seed));
+        Case c;
+        c.run = [activities] {
+            return static_cast<long long>(IntervalPartitioner::minResources(*activities).resourcesUsed);
+        };
+        return c;
+    }});
+    list.push_back({"IntervalPartitioner::kResources", SIZE_MAX, 48, [](Pattern p, size_t n, uint64_t seed) {
+        auto activities = std::make_shared<std::vector<Activity>>(makeActivities(p, n, seed));
+        Case c;
+        c.run = [activities] {
+            return static_cast<long long>(IntervalPartitioner::kResources(*activities, 4).scheduled);
+        };
+        return c;
+    }});
+    list.push_back({"WeightedIntervalScheduler::build", SIZE_MAX, 64, [](Pattern p, size_t n, uint64_t seed) {
+        auto activities = std::make_shared<std::vector<Activity>>(makeActivities(p, n, seed));
+        std::vector<int> values = makeInts(Pattern::Random, n, 1, 1000, seed + 2);
+        auto weights = std::make_shared<std::vector<long long>>(values.begin(), values.end());
+        Case c;
+        c.run = [activities, weights] {
+            WeightedIntervalScheduler scheduler;
+            scheduler.build(*activities, *weights);
+            return scheduler.bestValue();
+        };
+        return c;
+    }});
+
+    return list;
+}
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+struct Options {
+    std::string filter;
+    std::vector<Pattern> patterns;
+    size_t minSize = 1000;
+    size_t maxSize = 1000000000;
+    int warmup = 1;
+    int reps = 5;
+    double minTime = 0.05;   // keep repeating small cases until this much is measured
+    double maxSeconds = 2.0; // skip sizes whose single run would take longer
+    size_t maxBytes = size_t(1) << 30;
+    uint64_t seed = 42;
+    std::string jsonPath;
+};
+
+struct Result {
+    std::string name;
+    std::string pattern;
+    size_t n = 0;
+    size_t runs = 0;
+    double median = 0, mad = 0, min = 0, max = 0; // seconds
+    size_t outliers = 0;                            // runs beyond median + 3 * MAD
+    long long checksum = 0;
+};
+
+double medianOf(std::vector<double> v) {
+    if (v.empty()) return 0.0;
+    size_t mid = v.size() / 2;
+    std::nth_element(v.begin(), v.begin() + mid, v.end());
+    double m = v[mid];
+    if (v.size() % 2 == 0) {
+        m = (m + *std::max_element(v.begin(), v.begin() + mid)) / 2;
+    }
+    return m;
+}
+
+Result measure(Case& c, const Options& opt) {
+    using Clock = std::chrono::steady_clock;
+    Result r;
+    for (int i = 0; i < opt.warmup; i++) {
+        c.reset();
+        r.checksum += c.run();
+    }
+
+    std::vector<double> samples;
+    double measured = 0.0;
+    const size_t maxRuns = static_cast<size_t>(opt.reps) * 100;
+    while (samples.size() < static_cast<size_t>(opt.reps) ||
+           (measured < opt.minTime && samples.size() < maxRuns)) {
+        c.reset();
+        auto t0 = Clock::now();
+        r.checksum += c.run();
+        double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+        samples.push_back(sec);
+        measured += sec;
+    }
+
+    r.runs = samples.size();
+    r.median = medianOf(samples);
+    std::vector<double> deviations(samples.size());
+    for (size_t i = 0; i < samples.size(); i++) {
+        deviations[i] = std::fabs(samples[i] - r.median);
+    }
+    r.mad = medianOf(deviations);
+    r.min = *std::min_element(samples.begin(), samples.end());
+    r.max = *std::max_element(samples.begin(), samples.end());
+    for (double s : samples) {
+        r.outliers += (s > r.median + 3 * r.mad);
+    }
+    return r;
+}
+
+// ---------------------------------------------------------------------------
+// JSON output / comparison
+// ---------------------------------------------------------------------------
+
+std::string toJson(const Result& r) {
+    std::ostringstream out;
+    out << std::setprecision(9);
+    out << "{\"name\": \"" << r.name << "\", \"pattern\": \"" << r.pattern << "\", \"n\": " << r.n
+        << ", \"runs\": " << r.runs << ", \"median_s\": " << r.median << ", \"mad_s\": " << r.mad
+        << ", \"min_s\": " << r.min << ", \"max_s\": " << r.max << ", \"outliers\": " << r.outliers
+        << ", \"ns_per_element\": " << (r.n ? r.median * 1e9 / r.n : 0.0) << "}";
+    return out.str();
+}
+
+// Value of "key" in a single-line JSON object written by toJson()
+std::string jsonField(const std::string& line, const std::string& key) {
+    std::string needle = "\"" + key + "\": ";
+    size_t pos = line.find(needle);
+    if (pos == std::string::npos) return "";
+    pos += needle.size();
+    if (line[pos] == '"') {
+        size_t end = line.find('"', pos + 1);
+        return line.substr(pos + 1, end - pos - 1);
+    }
+    size_t end = line.find_first_of(",}", pos);
+    return line.substr(pos, end - pos);
+}
+
+bool readResults(const std::string& path, std::map<std::string, Result>& results) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Cannot open " << path << "\n";
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find("\"median_s\"") == std::string::npos) continue;
+        Result r;
+        r.name = jsonField(line, "name");
+        r.pattern = jsonField(line, "pattern");
+        r.n = std::stoull(jsonField(line, "n"));
+        r.median = std::stod(jsonField(line, "median_s"));
+        r.mad = std::stod(jsonField(line, "mad_s"));
+        // Files written before min_s / max_s existed fall back to the median
+        std::string minField = jsonField(line, "min_s"), maxField = jsonField(line, "max_s");
+        r.min = minField.empty() ? r.median : std::stod(minField);
+        r.max = maxField.empty() ? r.median : std::stod(maxField);
+        results[r.name + " " + r.pattern + " " + std::to_string(r.n)] = r;
+    }
+    return true;
+}
+
+struct Comparison {
+    int compared = 0, regressions = 0, improvements = 0;
+};
+
+// A case regressed if its median is slower by more than `threshold` (relative)
+// and its fastest run is slower than the slowest run of the base. Within-run
+// MAD understates the drift between two runs, so the gate is the between-run
+// spread: overlapping [min, max] ranges are never flagged.
+Comparison compareCases(const std::map<std::string, Result>& base, const std::map<std::string, Result>& current,
+                        double threshold, bool print) {
+    Comparison result;
+    if (print) {
+        std::cout << std::left << std::setw(60) << "case" << std::right << std::setw(14) << "base ms"
+                  << std::setw(14) << "new ms" << std::setw(10) << "change" << "\n";
+    }
+    for (const auto& [key, b] : base) {
+        auto it = current.find(key);
+        if (it == current.end()) continue;
+        const Result& c = it->second;
+        result.compared++;
+        double change = b.median > 0 ? (c.median - b.median) / b.median : 0.0;
+        const char* verdict = "";
+        if (change > threshold && c.min > b.max) {
+            verdict = "  REGRESSION";
+            result.regressions++;
+        } else if (change < -threshold && c.max < b.min) {
+            verdict = "  improved";
+            result.improvements++;
+        }
+        if (print) {
+            std::cout << std::left << std::setw(60) << key << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(14) << b.median * 1e3 << std::setw(14) << c.median * 1e3
+                      << std::setw(9) << std::showpos << change * 100 << "%" << std::noshowpos << verdict << "\n";
+        }
+    }
+    return result;
+}
+
+int compareResults(const std::string& basePath, const std::string& newPath, double threshold) {
+    std::map<std::string, Result> base, current;
+    if (!readResults(basePath, base) || !readResults(newPath, current)) {
+        return 2;
+    }
+    Comparison result = compareCases(base, current, threshold, true);
+    std::cout << "\n" << result.compared << " cases compared, " << result.regressions << " regressions, "
+              << result.improvements << " improvements (threshold " << threshold * 100 << "%)\n";
+    return result.regressions > 0 ? 1 : 0;
+}
+
+// Checks the comparison gate on synthetic result files; returns 0 if every case passes
+int selfTest() {
+    std::vector<Result> results;
+    for (int i = 0; i < 50; i++) {
+        Result r;
+        r.name = "case" + std::to_string(i);
+        r.pattern = "random";
+        r.n = 1000;
+        r.runs = 5;
+        r.median = 1e-3 * (i + 1);
+        r.mad = 0.02 * r.median;
+        r.min = 0.9 * r.median;
+        r.max = 1.2 * r.median;
+        results.push_back(r);
+    }
+    auto roundTrip = [](const std::vector<Result>& rs, double scale, std::map<std::string, Result>& out) {
+        char path[] = "/tmp/benchmark-suite-selftest-XXXXXX";
+        int fd = ::mkstemp(path);
+        if (fd < 0) {
+            std::cerr << "Cannot create a temporary file\n";
+            return false;
+        }
+        ::close(fd);
+        {
+            std::ofstream file(path);
+            for (Result r : rs) {
+                r.median *= scale;
+                r.mad *= scale;
+                r.min *= scale;
+                r.max *= scale;
+                file << toJson(r) << "\n";
+            }
+        }
+        bool ok = readResults(path, out);
+        std::remove(path);
+        return ok;
+    };
+    std::map<std::string, Result> base, same, noisy, slower;
+    if (!roundTrip(results, 1.0, base) || !roundTrip(results, 1.0, same) ||
+        !roundTrip(results, 1.25, noisy) || !roundTrip(results, 1.5, slower)) {
+        return 2;
+    }
+
+    int failures = 0;
+    auto check = [&failures](const char* label, const Comparison& c, int regressions, int improvements) {
+        bool ok = c.compared == 50 && c.regressions == regressions && c.improvements == improvements;
+        std::cout << label << ": " << c.regressions << " regressions, " << c.improvements << " improvements"
+                  << (ok ? "" : "  FAILED") << "\n";
+        failures += !ok;
+    };
+
+    std::cout << "--- Test Case 1: A file compared with itself ---\n";
+    check("Same file", compareCases(base, same, 0.10, false), 0, 0); // Expected: 0 regressions, 0 improvements
+
+    std::cout << "\n--- Test Case 2: 25% slower, ranges still overlap ---\n";
+    check("Overlapping", compareCases(base, noisy, 0.10, false), 0, 0); // Expected: 0 regressions, 0 improvements
+
+    std::cout << "\n--- Test Case 3: 50% slower, ranges disjoint ---\n";
+    check("Slower", compareCases(base, slower, 0.10, false), 50, 0); // Expected: 50 regressions
+    check("Faster", compareCases(slower, base, 0.10, false), 0, 50); // Expected: 50 improvements
+
+    std::cout << "\n" << (failures == 0 ? "Self-test passed" : "Self-test FAILED") << "\n";
+    return failures == 0 ? 0 : 1;
+}
+
+// ---------------------------------------------------------------------------
+// Driver
+// ---------------------------------------------------------------------------
+
+void printUsage() {
+    std::cout <<
+        "Usage: benchmark-suite [options]\n"
+        "       benchmark-suite --compare base.json new.json [--threshold 0.10]\n"
+        "       benchmark-suite --self-test\n"
+        "  --list               list benchmarks and exit\n"
+        "  --filter TEXT        only benchmarks whose name contains TEXT\n"
+        "  --patterns a,b       subset of random,sorted,reversed,skewed,adversarial\n"
+        "  --min-size N         smallest size (default 1000)\n"
+        "  --max-size N         largest size (default 1000000000)\n"
+        "  --warmup N           untimed runs per case (default 1)\n"
+        "  --reps N             minimum timed runs per case (default 5)\n"
+        "  --min-time S         keep repeating fast cases until S seconds are measured (default 0.05)\n"
+        "  --max-seconds S      skip sizes whose single run is predicted above S (default 2)\n"
+        "  --max-bytes N        skip sizes whose input would exceed N bytes (default 1 GiB)\n"
+        "  --seed N             generator seed (default 42)\n"
+        "  --json FILE          also write results to FILE\n";
+}
+
+int run(const Options& opt) {
+    std::vector<Benchmark> benchmarks = registry();
+    std::vector<Result> results;
+    volatile long long sink = 0;
+
+    std::cout << std::left << std::setw(40) << "benchmark" << std::setw(12) << "pattern" << std::right
+              << std::setw(12) << "n" << std::setw(14) << "median ms" << std::setw(10) << "mad %"
+              << std::setw(14) << "ns/element" << "\n";
+
+    for (const auto& b : benchmarks) {
+        if (!opt.filter.empty() && b.name.find(opt.filter) == std::string::npos) continue;
+
+        for (Pattern p : opt.patterns) {
+            const char* patternName = "";
+            for (const auto& [value, name] : kPatterns) {
+                if (value == p) patternName = name;
+            }
+
+            double lastTime = 0.0, exponent = b.growth;
+            size_t lastN = 0;
+            for (size_t n = 1000; n <= opt.maxSize; n *= 10) {
+                if (n < opt.minSize) continue;
+                if (n > b.maxSize || n > opt.maxBytes / b.bytesPerElement) break;
+                if (lastN > 0) {
+                    // Extrapolate with the growth rate seen so far
+                    double predicted = lastTime * std::pow(static_cast<double>(n) / lastN, exponent);
+                    if (predicted > opt.maxSeconds) break;
+                }
+
+                Case c = b.make(p, n, opt.seed);
+                Result r = measure(c, opt);
+                r.name = b.name;
+                r.pattern = patternName;
+                r.n = n;
+                sink = sink + r.checksum;
+
+                std::cout << std::left << std::setw(40) << r.name << std::setw(12) << r.pattern << std::right
+                          << std::setw(12) << r.n << std::fixed << std::setprecision(3)
+                          << std::setw(14) << r.median * 1e3 << std::setprecision(1)
+                          << std::setw(10) << (r.median > 0 ? 100 * r.mad / r.median : 0.0)
+                          << std::setprecision(2) << std::setw(14) << r.median * 1e9 / n << "\n";
+
+                if (lastN > 0 && lastTime > 1e-6 && r.median > 1e-6) {
+                    exponent = std::max(b.growth, std::log(r.median / lastTime) / std::log(static_cast<double>(n) / lastN));
+                }
+                lastTime = r.median;
+                lastN = n;
+                results.push_back(r);
+            }
+        }
+    }
+
+    if (!opt.jsonPath.empty()) {
+        std::ofstream out(opt.jsonPath);
+        if (!out) {
+            std::cerr << "Cannot write " << opt.jsonPath << "\n";
+            return 2;
+        }
+        out << "{\"seed\": " << opt.seed << ", \"results\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            out << toJson(results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "]}\n";
+        std::cout << "\nWrote " << results.size() << " results to " << opt.jsonPath << "\n";
+    }
+    return 0;
+}
+
+} // namespace bench
+
+int main(int argc, char* argv[]) {
+    bench::Options opt;
+    std::vector<std::string> args(argv + 1, argv + argc);
+    std::string compareBase, compareNew;
+    double threshold = 0.10;
+
+    for (size_t i = 0; i < args.size(); i++) {
+        const std::string& a = args[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= args.size()) {
+                std::cerr << "Missing value for " << a << "\n";
+                std::exit(2);
+            }
+            return args[++i];
+        };
+        if (a == "--help" || a == "-h") {
+            bench::printUsage();
+            return 0;
+        } else if (a == "--list") {
+            for (const auto& b : bench::registry()) std::cout << b.name << "\n";
+            return 0;
+        } else if (a == "--self-test") {
+            return bench::selfTest();
+        } else if (a == "--compare") {
+            compareBase = next();
+            compareNew = next();
+        } else if (a == "--threshold") {
+            threshold = std::stod(next());
+        } else if (a == "--filter") {
+            opt.filter = next();
+        } else if (a == "--patterns") {
+            std::stringstream list(next());
+            std::string name;
+            while (std::getline(list, name, ',')) {
+                bool known = false;
+                for (const auto& [value, patternName] : bench::kPatterns) {
+                    if (name == patternName) {
+                        opt.patterns.push_back(value);
+                        known = true;
+                    }
+                }
+                if (!known) {
+                    std::cerr << "Unknown pattern: " << name << "\n";
+                    return 2;
+                }
+            }
+        } else if (a == "--min-size") {
+            opt.minSize = std::stoull(next());
+        } else if (a == "--max-size") {
+            opt.maxSize = std::stoull(next());
+        } else if (a == "--warmup") {
+            opt.warmup = std::stoi(next());
+        } else if (a == "--reps") {
+            opt.reps = std::max(1, std::stoi(next()));
+        } else if (a == "--min-time") {
+            opt.minTime = std::stod(next());
+        } else if (a == "--max-seconds") {
+            opt.maxSeconds = std::stod(next());
+        } else if (a == "--max-bytes") {
+            opt.maxBytes = std::stoull(next());
+        } else if (a == "--seed") {
+            opt.seed = std::stoull(next());
+        } else if (a == "--json") {
+            opt.jsonPath = next();
+        } else {
+            std::cerr << "Unknown option: " << a << "\n";
+            bench::printUsage();
+            return 2;
+        }
+    }
+
+    if (!compareBase.empty()) {
+        return bench::compareResults(compareBase, compareNew, threshold);
+    }
+    if (opt.patterns.empty()) {
+        for (const auto& [value, name] : bench::kPatterns) opt.patterns.push_back(value);
+    }
+    return bench::run(opt);
+}
@@ -0,0 +1,269 @@
+#ifndef DSA_PERF_COUNTERS_H
+#define DSA_PERF_COUNTERS_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Hardware Performance Counters for Algorithm Hot Paths
+ *
+ * Wall-clock time says that merge() got slower, not why. This layer
+ * counts, per named region:
+ * - cycles and instructions (IPC)
+ * - branch misses
+ * - L1 data-cache and last-level-cache misses
+ * - page faults (first touch of freshly allocated memory)
+ *
+ * How it works:
+ * 1. The first region on a thread opens one perf_event_open group for
+ *    that thread (user-space only, so perf_event_paranoid <= 2 is enough)
+ * 2. A Region reads the whole group once on entry and once on exit (one
+ *    read() each) and adds the difference to its per-name totals
+ * 3. Registry::report() prints every region's costs per element
+ *
+ * Counters that cannot be opened (no PMU in a VM, non-Linux systems,
+ * DSA_PERF_DISABLE set in the environment) are reported as "-"; regions
+ * then still record calls, elements and wall time.
+ *
+ * The algorithm files mark their phases with DSA_PERF_REGION, which they
+ * define as a no-op unless this header was included before them.
+ * Regions are not thread-safe; each read costs about a microsecond, so
+ * very small regions should be skipped with DSA_PERF_REGION_IF.
+ */
+
+namespace perf {
+
+enum Counter { Cycles, Instructions, BranchMisses, L1DMisses, LLCMisses, PageFaults, kNumCounters };
+
+const char* const kCounterNames[kNumCounters] = {
+    "cycles", "instr", "br-miss", "L1d-miss", "LLC-miss", "faults"
+};
+
+struct Snapshot {
+    std::array<uint64_t, kNumCounters> value{};
+    std::chrono::steady_clock::time_point time;
+};
+
+// One perf_event group for the calling thread
+class CounterGroup {
+public:
+    static CounterGroup& forThisThread() {
+        thread_local CounterGroup group;
+        return group;
+    }
+
+    bool available(Counter c) const { return slot_[c] >= 0; }
+    const std::string& status() const { return status_; }
+
+    // Current counter values (scaled if the kernel had to multiplex) and time
+    void read(Snapshot& s) const {
+#ifdef __linux__
+        if (leader_ >= 0) {
+            // Layout for PERF_FORMAT_GROUP: nr, time_enabled, time_running, values[nr]
+            uint64_t buffer[3 + kNumCounters];
+            if (::read(leader_, buffer, sizeof(buffer)) > 0) {
+                double scale = (buffer[2] > 0 && buffer[2] < buffer[1])
+                                   ? static_cast<double>(buffer[1]) / buffer[2] : 1.0;
+                for (int c = 0; c < kNumCounters; c++) {
+                    if (slot_[c] >= 0) {
+                        s.value[c] = static_cast<uint64_t>(buffer[3 + slot_[c]] * scale);
+                    }
+                }
+            }
+        }
+#endif
+        s.time = std::chrono::steady_clock::now();
+    }
+
+    ~CounterGroup() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            close(fd);
+        }
+#endif
+    }
+
+    CounterGroup(const CounterGroup&) = delete;
+    CounterGroup& operator=(const CounterGroup&) = delete;
+
+private:
+    int leader_ = -1;
+    std::vector<int> fds_;
+    std::array<int, kNumCounters> slot_; // index in the group read, or -1
+    std::string status_;
+
+    CounterGroup() {
+        slot_.fill(-1);
+#ifdef __linux__
+        if (std::getenv("DSA_PERF_DISABLE")) {
+            status_ = "disabled by DSA_PERF_DISABLE";
+            return;
+        }
+        const std::pair<uint32_t, uint64_t> events[kNumCounters] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                 (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS}
+        };
+        std::string failed;
+        int members = 0;
+        for (int c = 0; c < kNumCounters; c++) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events[c].first;
+            attr.config = events[c].second;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.disabled = (leader_ < 0); // the leader starts the whole group
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+            if (fd < 0) {
+                failed += std::string(failed.empty() ? "" : ", ") + kCounterNames[c] + " (" +
+                          std::strerror(errno) + ")";
+                continue;
+            }
+            if (leader_ < 0) {
+                leader_ = fd;
+            }
+            fds_.push_back(fd);
+            slot_[c] = members++;
+        }
+        if (leader_ >= 0) {
+            ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+        status_ = failed.empty() ? "all counters available" : "unavailable: " + failed;
+#else
+        status_ = "perf_event_open needs Linux; wall time only";
+#endif
+    }
+};
+
+// Accumulated totals of one named region
+struct RegionStats {
+    uint64_t calls = 0;
+    uint64_t elements = 0;
+    double seconds = 0.0;
+    std::array<uint64_t, kNumCounters> counts{};
+};
+
+class Registry {
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    // References stay valid for the lifetime of the program
+    RegionStats& stats(const char* name) { return regions_[name]; }
+
+    void reset() {
+        for (auto& entry : regions_) {
+            entry.second = RegionStats();
+        }
+    }
+
+    // One line per region: totals, then every cost divided by the element count
+    void report(std::ostream& out) const {
+        const CounterGroup& group = CounterGroup::forThisThread();
+        out << "Counters: " << group.status() << "\n";
+        out << std::left << std::setw(32) << "region" << std::right << std::setw(8) << "calls"
+            << std::setw(14) << "elements" << std::setw(10) << "ns/elem";
+        for (int c = 0; c < kNumCounters; c++) {
+            out << std::setw(10) << kCounterNames[c];
+        }
+        out << std::setw(7) << "IPC" << "\n";
+
+        for (const auto& [name, s] : regions_) {
+            if (s.calls == 0) continue;
+            double perElement = s.elements ? 1.0 / s.elements : 0.0;
+            out << std::left << std::setw(32) << name << std::right << std::setw(8) << s.calls
+                << std::setw(14) << s.elements << std::fixed << std::setprecision(2)
+                << std::setw(10) << s.seconds * 1e9 * perElement;
+            for (int c = 0; c < kNumCounters; c++) {
+                if (group.available(static_cast<Counter>(c))) {
+                    out << std::setw(10) << s.counts[c] * perElement;
+                } else {
+                    out << std::setw(10) << "-";
+                }
+            }
+            if (group.available(Cycles) && group.available(Instructions) && s.counts[Cycles] > 0) {
+                out << std::setw(7) << static_cast<double>(s.counts[Instructions]) / s.counts[Cycles];
+            } else {
+                out << std::setw(7) << "-";
+            }
+            out << "\n";
+        }
+        out << std::defaultfloat;
+    }
+
+private:
+    std::map<std::string, RegionStats> regions_;
+};
+
+// Scoped measurement: counts everything between construction and destruction
+class Region {
+public:
+    Region(const char* name, uint64_t elements, bool active = true)
+        : stats_(active ? &Registry::instance().stats(name) : nullptr), elements_(elements) {
+        if (stats_) {
+            CounterGroup::forThisThread().read(start_);
+        }
+    }
+
+    ~Region() {
+        if (!stats_) return;
+        Snapshot end;
+        CounterGroup::forThisThread().read(end);
+        stats_->calls++;
+        stats_->elements += elements_;
+        stats_->seconds += std::chrono::duration<double>(end.time - start_.time).count();
+        for (int c = 0; c < kNumCounters; c++) {
+            stats_->counts[c] += end.value[c] - start_.value[c];
+        }
+    }
+
+    Region(const Region&) = delete;
+    Region& operator=(const Region&) = delete;
+
+private:
+    RegionStats* stats_;
+    uint64_t elements_;
+    Snapshot start_;
+};
+
+} // namespace perf
+
+#define DSA_PERF_CONCAT_(a, b) a##b
+#define DSA_PERF_CONCAT(a, b) DSA_PERF_CONCAT_(a, b)
+
+// Measures the rest of the enclosing scope as region `name`
+#define DSA_PERF_REGION(name, elements) \
+    perf::Region DSA_PERF_CONCAT(dsaPerfRegion, __LINE__)((name), (elements))
+
+// Same, but only when `condition` holds (e.g. to skip tiny recursive calls)
+#define DSA_PERF_REGION_IF(condition, name, elements) \
+    perf::Region DSA_PERF_CONCAT(dsaPerfRegion, __LINE__)((name), (elements), (condition))
+
+#endif // DSA_PERF_COUNTERS_H
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdlib>
+
+// Must come first: turns the DSA_PERF_REGION hooks in the algorithm files into real regions
+#include "perf-counters.h"
+
+// Reuse the algorithms without pulling in their demo main() functions
+#define DSA_NO_MAIN
+#include "../sorting/merge-sort.cpp"
+#include "../arrays/max-subarray.cpp"
+#include "../arrays/three-sum.cpp"
+#include "../greedy-algorithms/huffman-coding.cpp"
+
+/**
+ * Per-Phase Counter Report
+ *
+ * Runs the instrumented algorithms on random input and prints the cost
+ * of each phase per element: time, cycles, instructions, branch misses,
+ * L1d / LLC misses and page faults.
+ *
+ * Phases:
+ * - merge-sort: copy into L/R, merge back (merges of >= 4096 elements)
+ * - max-subarray: one region per approach, prefix sum split in build / scan
+ * - three-sum: the hash loop and the brute-force triple loop
+ * - huffman: build heap, build tree, assign codes
+ *
+ * Usage: perf-report [n] [reps]   (default n = 1000000, reps = 3)
+ * Build: g++ -std=c++17 -O2 perf-report.cpp -o perf-report
+ */
+
+// Swallows huffmanCoding's code table
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+std::vector<int> randomInts(size_t n, int lo, int hi, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(lo, hi);
+    std::vector<int> v(n);
+    for (auto& x : v) x = dist(rng);
+    return v;
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    int reps = argc > 2 ? std::atoi(argv[2]) : 3;
+    if (n < 16 || reps < 1) {
+        std::cerr << "Usage: perf-report [n >= 16] [reps >= 1]\n";
+        return 1;
+    }
+    long long sink = 0;
+
+    for (int rep = 0; rep < reps; rep++) {
+        // --- merge-sort.cpp ---
+        std::vector<int> arr = randomInts(n, -1000000000, 1000000000, 1 + rep);
+        {
+            DSA_PERF_REGION("merge-sort/total", n);
+            mergeSort(arr, 0, static_cast<int>(n) - 1);
+        }
+        sink += arr[n / 2];
+
+        // --- max-subarray.cpp ---
+        std::vector<int> values = randomInts(n, -10, 10, 100 + rep);
+        sink += MaxSubarray::kadane(values);
+        sink += std::get<0>(MaxSubarray::kadaneWithIndices(values));
+        sink += MaxSubarray::divideAndConquer(values, 0, static_cast<long long>(n) - 1);
+        sink += MaxSubarray::prefixSum(values);
+        std::vector<int> head(values.begin(), values.begin() + std::min<size_t>(n, 20000));
+        sink += MaxSubarray::bruteForce(head); // O(n^2): capped
+
+        // --- three-sum.cpp --- (unreachable target, so both versions search everything)
+        std::vector<int> nums = randomInts(std::min<size_t>(n, 3000), -100000, 100000, 200 + rep);
+        sink += static_cast<long long>(threeSum(nums, 1000000).size());
+        nums.resize(std::min<size_t>(nums.size(), 600));
+        sink += static_cast<long long>(threeSumBruteForce(nums, 1000000).size());
+
+        // --- huffman-coding.cpp ---
+        size_t symbols = std::min<size_t>(n, 200000);
+        std::vector<int> freq = randomInts(symbols, 1, 10000, 300 + rep);
+        std::vector<char> data(symbols);
+        for (size_t i = 0; i < symbols; i++) {
+            data[i] = static_cast<char>('a' + i % 26);
+        }
+        NullBuffer null;
+        std::streambuf* saved = std::cout.rdbuf(&null);
+        {
+            DSA_PERF_REGION("huffman/total", symbols);
+            huffmanCoding(data, freq);
+        }
+        std::cout.rdbuf(saved);
+    }
+
+    std::cout << "--- Per-element costs (n = " << n << ", " << reps << " reps) ---\n";
+    perf::Registry::instance().report(std::cout);
+    std::cout << "(checksum " << sink << ")\n";
+    return 0;
+}
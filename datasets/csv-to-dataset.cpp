@@ -0,0 +1,231 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cstdio>
+
+// Record types and their dataset layouts, without the demo main() functions
+#define DSA_NO_MAIN
+#include "../greedy-algorithms/fractional-knapsack.cpp"
+#include "../greedy-algorithms/job-sequencing.cpp"
+#include "../greedy-algorithms/activity-selection.cpp"
+
+#include "dataset.h"
+
+/**
+ * CSV to Binary Dataset Converter
+ *
+ * Usage: csv-to-dataset <int|item|job|activity> input.csv output.bin
+ *        csv-to-dataset            (runs the built-in examples)
+ *
+ * Expected columns:
+ *   int       value                (merge-sort, max-subarray, three-sum)
+ *   item      value, weight        (fractional-knapsack)
+ *   job       id, deadline, profit (job-sequencing; id may be a single letter)
+ *   activity  start, finish        (activity-selection)
+ *
+ * The input is memory-mapped and parsed by dsa::CsvReader, and records go
+ * out through DatasetWriter's fixed buffer: no allocation per row, so the
+ * conversion runs at disk speed even for multi-gigabyte files.
+ * Extra columns are ignored; a malformed row or a value that does not fit
+ * its field stops the conversion with the line number.
+ */
+
+// Whole file as a read-only mapping
+class MappedText {
+public:
+    explicit MappedText(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == 0) {
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ == 0) {
+                valid_ = true; // empty input, empty dataset
+            } else {
+                void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    ::madvise(p, size_, MADV_SEQUENTIAL);
+                    data_ = static_cast<const char*>(p);
+                    valid_ = true;
+                }
+            }
+        }
+        ::close(fd);
+    }
+
+    ~MappedText() {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    MappedText(const MappedText&) = delete;
+    MappedText& operator=(const MappedText&) = delete;
+
+    bool valid() const { return valid_; }
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool valid_ = false;
+};
+
+// Writes to "<output>.tmp" and renames it into place only when every record
+// made it, so a failed conversion leaves no partial dataset behind (and an
+// existing output file is kept)
+template <typename T>
+int convert(const char* data, size_t size, const std::string& outputPath) {
+    using Layout = dsa::DatasetLayout<T>;
+    const std::string tempPath = outputPath + ".tmp";
+    dsa::DatasetWriter<T> writer;
+    auto fail = [&](const std::string& message) {
+        std::cerr << message << "\n";
+        writer.close();
+        std::remove(tempPath.c_str());
+        return 1;
+    };
+    if (!writer.open(tempPath)) {
+        return fail("Cannot create " + tempPath);
+    }
+
+    dsa::CsvReader reader(data, size);
+    long long columns[Layout::columns];
+    T record;
+    while (reader.next(columns, Layout::columns, Layout::letterColumns)) {
+        if (!Layout::fromColumns(columns, record)) {
+            return fail("Line " + std::to_string(reader.line()) + ": value out of range");
+        }
+        if (!writer.append(record)) {
+            return fail("Write error on " + tempPath);
+        }
+    }
+    if (reader.bad()) {
+        return fail("Line " + std::to_string(reader.line()) + ": expected " +
+                    std::to_string(Layout::columns) + " numeric columns");
+    }
+    uint64_t count = writer.count();
+    if (!writer.close()) {
+        return fail("Write error on " + tempPath);
+    }
+    if (std::rename(tempPath.c_str(), outputPath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        std::cerr << "Cannot rename " << tempPath << " to " << outputPath << "\n";
+        return 1;
+    }
+    std::cout << "Wrote " << count << " records (" << sizeof(T) << " bytes each) to " << outputPath << "\n";
+    return 0;
+}
+
+// Parses `text` as one record of `columns` fields; prints the values or the rejection
+void parseLine(const std::string& text, size_t columns, uint32_t letterColumns = 0) {
+    dsa::CsvReader reader(text.data(), text.size());
+    long long values[4];
+    if (reader.next(values, columns, letterColumns)) {
+        std::cout << "Parsed:";
+        for (size_t i = 0; i < columns; i++) std::cout << " " << values[i];
+        std::cout << "\n";
+    } else {
+        std::cout << "Rejected (bad " << reader.bad() << ", line " << reader.line() << ")\n";
+    }
+}
+
+bool fileExists(const std::string& path) {
+    struct stat st;
+    return ::stat(path.c_str(), &st) == 0;
+}
+
+// Built-in examples, run when the program gets no arguments
+int runExamples() {
+    std::cout << "--- Test Case 1: Separators, signs and a header ---\n";
+    std::string csv = "value,weight\n60, 10\n-5\t+7\n";
+    dsa::CsvReader reader(csv.data(), csv.size());
+    long long row[2];
+    while (reader.next(row, 2)) {
+        std::cout << "Line " << reader.line() << ": " << row[0] << " " << row[1] << "\n";
+    }
+    // Expected: Line 2: 60 10, Line 3: -5 7
+
+    std::cout << "\n--- Test Case 2: Values past 2^64 are rejected, not wrapped ---\n";
+    parseLine("18446744073709551616", 1);  // Expected: Rejected (2^64 used to wrap to 0)
+    parseLine("184467440737095516170", 1); // Expected: Rejected
+    parseLine("4611686018427387904", 1);   // Expected: Parsed: 4611686018427387904 (2^62, the limit)
+    parseLine("4611686018427387905", 1);   // Expected: Rejected
+    parseLine("-4611686018427387904", 1);  // Expected: Parsed: -4611686018427387904
+
+    std::cout << "\n--- Test Case 3: A job id is one letter or a number ---\n";
+    parseLine("a,2,100", 3, 1); // Expected: Parsed: 97 2 100
+    parseLine("7,2,100", 3, 1); // Expected: Parsed: 7 2 100
+    parseLine("abc,2,100", 3, 1); // Expected: Rejected
+    parseLine("a7,2,100", 3, 1);  // Expected: Rejected
+
+    std::cout << "\n--- Test Case 4: A failed conversion leaves no file ---\n";
+    const std::string path = "/tmp/csv-to-dataset-example.bin";
+    std::string bad = "1\n2\n9999999999\n4\n"; // third value does not fit an int
+    int status = convert<int>(bad.data(), bad.size(), path);
+    std::cout << "Status " << status << ", output exists: " << fileExists(path) << "\n"; // Expected: Status 1, 0
+    std::string good = "1\n2\n3\n4\n";
+    status = convert<int>(good.data(), good.size(), path);
+    std::cout << "Status " << status << ", output exists: " << fileExists(path) << "\n"; // Expected: Status 0, 1
+    status = convert<int>(bad.data(), bad.size(), path);
+    dsa::Dataset<const int> kept;
+    bool loaded = kept.open(path);
+    std::cout << "Status " << status << ", previous output kept: " << (loaded && kept.size() == 4) << "\n";
+    // Expected: Status 1, previous output kept: 1
+    std::remove(path.c_str());
+
+    std::cout << "\n--- Test Case 5: Job padding is written as zeros ---\n";
+    std::string jobs = "a,2,100\nb,1,19\n";
+    status = convert<Job>(jobs.data(), jobs.size(), path);
+    dsa::Dataset<const Job> written;
+    bool zeroPadding = status == 0 && written.open(path) && written.size() == 2;
+    for (size_t i = 0; zeroPadding && i < written.size(); i++) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&written.elements()[i]);
+        for (size_t b = sizeof(char); b < offsetof(Job, deadline); b++) {
+            zeroPadding = zeroPadding && bytes[b] == 0;
+        }
+    }
+    std::cout << "Padding bytes zero: " << zeroPadding << "\n"; // Expected: 1
+    std::remove(path.c_str());
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 1) {
+        return runExamples();
+    }
+    if (argc != 4) {
+        std::cerr << "Usage: csv-to-dataset <int|item|job|activity> input.csv output.bin\n";
+        return 1;
+    }
+    std::string type = argv[1];
+    MappedText input(argv[2]);
+    if (!input.valid()) {
+        std::cerr << "Cannot read " << argv[2] << "\n";
+        return 1;
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    int status;
+    if (type == "int") {
+        status = convert<int>(input.data(), input.size(), argv[3]);
+    } else if (type == "item") {
+        status = convert<Item>(input.data(), input.size(), argv[3]);
+    } else if (type == "job") {
+        status = convert<Job>(input.data(), input.size(), argv[3]);
+    } else if (type == "activity") {
+        status = convert<Activity>(input.data(), input.size(), argv[3]);
+    } else {
+        std::cerr << "Unknown type: " << type << " (int, item, job or activity)\n";
+        return 1;
+    }
+    if (status == 0) {
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::cout << "Parsed " << input.size() / 1e6 << " MB in " << sec << " s ("
+                  << input.size() / 1e6 / sec << " MB/s)\n";
+    }
+    return status;
+}
@@ -0,0 +1,109 @@
+#ifndef DSA_DATASET_LAYOUT_H
+#define DSA_DATASET_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+/**
+ * Dataset Element Types
+ *
+ * The portable half of the dataset layer, included by the algorithm
+ * files themselves:
+ * - dsa::Span<T>: a non-owning view of contiguous elements, so the
+ *   algorithms work on a std::vector and on a memory-mapped dataset alike
+ * - dsa::DatasetLayout<T>: describes how T is stored in a dataset file
+ *   (type tag, field offsets, how to build it from CSV columns)
+ *
+ * Span is std::span under C++20. The repo targets C++17, so otherwise a
+ * minimal equivalent is provided; it converts implicitly from std::vector
+ * and std::array just like std::span does.
+ *
+ * The loader, writer and CSV parser (POSIX only) are in dataset.h.
+ */
+
+namespace dsa {
+
+#if __cplusplus >= 202002L
+template <typename T>
+using Span = std::span<T>;
+#else
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using iterator = T*;
+
+    constexpr Span() noexcept = default;
+    constexpr Span(T* data, size_type size) noexcept : data_(data), size_(size) {}
+
+    // Any contiguous container whose data() converts to T* (std::vector, std::array, ...)
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible_v<decltype(std::declval<Container&>().data()), T*>>>
+    constexpr Span(Container& c) noexcept : data_(c.data()), size_(c.size()) {}
+
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible_v<decltype(std::declval<const Container&>().data()), T*>>,
+              typename = void>
+    constexpr Span(const Container& c) noexcept : data_(c.data()), size_(c.size()) {}
+
+    // Span<T> -> Span<const T>
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr Span(const Span<U>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_type size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T& operator[](size_type i) const noexcept { return data_[i]; }
+    constexpr T& front() const noexcept { return data_[0]; }
+    constexpr T& back() const noexcept { return data_[size_ - 1]; }
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+    constexpr Span subspan(size_type offset, size_type count) const noexcept { return {data_ + offset, count}; }
+
+private:
+    T* data_ = nullptr;
+    size_type size_ = 0;
+};
+#endif
+
+// Element type tags stored in a dataset header
+enum class ElementType : uint32_t {
+    Int32 = 1,
+    Item = 2,     // fractional-knapsack.cpp
+    Job = 3,      // job-sequencing.cpp
+    Activity = 4  // activity-selection.cpp
+};
+
+// Specialized next to each struct:
+//   type                   - the ElementType tag
+//   columns                - CSV columns per record
+//   letterColumns          - bitmask of columns that may hold a letter (read as its char code)
+//   offsets[]              - offsetof() of every field, checked against the file
+//   fromColumns(c, out)    - builds a record from `columns` parsed integers;
+//                            false if a value does not fit its field. Any
+//                            padding in `out` must be zeroed
+template <typename T>
+struct DatasetLayout;
+
+template <>
+struct DatasetLayout<int> {
+    static constexpr ElementType type = ElementType::Int32;
+    static constexpr std::size_t columns = 1;
+    static constexpr uint32_t letterColumns = 0;
+    static constexpr uint32_t offsets[] = {0};
+    static bool fromColumns(const long long* c, int& out) {
+        out = static_cast<int>(c[0]);
+        return out == c[0];
+    }
+};
+
+} // namespace dsa
+
+#endif // DSA_DATASET_LAYOUT_H
@@ -0,0 +1,363 @@
+#ifndef DSA_DATASET_H
+#define DSA_DATASET_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dataset-layout.h"
+
+/**
+ * Zero-Copy Binary Datasets
+ *
+ * File format (native byte order, 64-byte header, then the raw records):
+ *
+ *   offset  size  field
+ *        0     8  magic "DSADATA\0"
+ *        8     4  version (1)
+ *       12     4  element type (ElementType)
+ *       16     8  element count
+ *       24     4  element size (sizeof the struct)
+ *       28     4  field count
+ *       32    24  field offsets (up to 6)
+ *       56     4  byte-order mark 0x01020304 as written
+ *       60     4  data offset (64)
+ *
+ * The layout fields make the file self-describing: a file is only
+ * accepted when type, size, field offsets and byte order all match the
+ * struct the program was compiled with, so records can be used in place.
+ *
+ * Dataset<const T> maps the file read-only. Dataset<T> maps it
+ * copy-on-write: the algorithms may sort or modify the records, pages are
+ * copied only when written, and the file itself never changes. Either way
+ * elements() hands out a Span over the mapping - nothing is read or copied
+ * up front, so a 10 GB file opens instantly.
+ *
+ * DatasetWriter produces files; CsvReader is the allocation-free parser
+ * behind csv-to-dataset.cpp. POSIX only (mmap).
+ */
+
+namespace dsa {
+
+struct DatasetHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t type;
+    uint64_t count;
+    uint32_t elementSize;
+    uint32_t fieldCount;
+    uint32_t fieldOffsets[6];
+    uint32_t byteOrder;
+    uint32_t dataOffset;
+};
+static_assert(sizeof(DatasetHeader) == 64, "dataset header must stay 64 bytes");
+
+constexpr char kDatasetMagic[8] = {'D', 'S', 'A', 'D', 'A', 'T', 'A', '\0'};
+constexpr uint32_t kDatasetVersion = 1;
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+// Header describing `count` records of T
+template <typename T>
+DatasetHeader makeHeader(uint64_t count) {
+    using Layout = DatasetLayout<T>;
+    constexpr std::size_t fields = sizeof(Layout::offsets) / sizeof(Layout::offsets[0]);
+    static_assert(fields <= 6, "at most 6 fields per record");
+
+    DatasetHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, kDatasetMagic, sizeof(h.magic));
+    h.version = kDatasetVersion;
+    h.type = static_cast<uint32_t>(Layout::type);
+    h.count = count;
+    h.elementSize = sizeof(T);
+    h.fieldCount = static_cast<uint32_t>(fields);
+    for (std::size_t f = 0; f < fields; f++) {
+        h.fieldOffsets[f] = Layout::offsets[f];
+    }
+    h.byteOrder = kByteOrderMark;
+    h.dataOffset = sizeof(DatasetHeader);
+    return h;
+}
+
+template <typename T>
+class Dataset {
+public:
+    using Record = std::remove_const_t<T>;
+
+    Dataset() = default;
+    ~Dataset() { close(); }
+
+    Dataset(const Dataset&) = delete;
+    Dataset& operator=(const Dataset&) = delete;
+
+    // Maps `path`; returns false (see error()) if it is missing or does not describe T
+    bool open(const std::string& path) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return fail(std::string("cannot open: ") + std::strerror(errno));
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(DatasetHeader)) {
+            ::close(fd);
+            return fail("file too small for a dataset header");
+        }
+        // Copy-on-write needs PROT_WRITE, but MAP_PRIVATE never writes back to the file
+        int prot = std::is_const_v<T> ? PROT_READ : PROT_READ | PROT_WRITE;
+        void* p = ::mmap(nullptr, st.st_size, prot, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping stays valid after close
+        if (p == MAP_FAILED) {
+            return fail(std::string("mmap failed: ") + std::strerror(errno));
+        }
+        base_ = static_cast<unsigned char*>(p);
+        mappedSize_ = static_cast<std::size_t>(st.st_size);
+
+        DatasetHeader h;
+        std::memcpy(&h, base_, sizeof(h));
+        std::string problem = check(h);
+        if (!problem.empty()) {
+            close();
+            return fail(problem);
+        }
+        count_ = static_cast<std::size_t>(h.count);
+        records_ = reinterpret_cast<T*>(base_ + h.dataOffset);
+        return true;
+    }
+
+    Span<T> elements() const { return {records_, count_}; }
+    std::size_t size() const { return count_; }
+    const std::string& error() const { return error_; }
+
+    // Hint for the kernel's read-ahead (e.g. MADV_SEQUENTIAL for a single scan)
+    void advise(int advice) const {
+        if (base_) {
+            ::madvise(base_, mappedSize_, advice);
+        }
+    }
+
+private:
+    unsigned char* base_ = nullptr;
+    std::size_t mappedSize_ = 0;
+    T* records_ = nullptr;
+    std::size_t count_ = 0;
+    std::string error_;
+
+    bool fail(const std::string& message) {
+        error_ = message;
+        return false;
+    }
+
+    void close() {
+        if (base_) {
+            ::munmap(base_, mappedSize_);
+        }
+        base_ = nullptr;
+        records_ = nullptr;
+        mappedSize_ = count_ = 0;
+    }
+
+    // Empty if the header describes Record and fits the file
+    std::string check(const DatasetHeader& h) const {
+        DatasetHeader expected = makeHeader<Record>(h.count);
+        if (std::memcmp(h.magic, kDatasetMagic, sizeof(h.magic)) != 0) {
+            return "not a dataset file (bad magic)";
+        }
+        if (h.version != kDatasetVersion) {
+            return "unsupported version " + std::to_string(h.version);
+        }
+        if (h.byteOrder != kByteOrderMark) {
+            return "written on a machine with a different byte order";
+        }
+        if (h.type != expected.type) {
+            return "element type " + std::to_string(h.type) + ", expected " + std::to_string(expected.type);
+        }
+        if (h.elementSize != expected.elementSize || h.fieldCount != expected.fieldCount ||
+            std::memcmp(h.fieldOffsets, expected.fieldOffsets, sizeof(h.fieldOffsets)) != 0) {
+            return "record layout differs from this build's struct";
+        }
+        if (h.dataOffset < sizeof(DatasetHeader) || h.dataOffset > mappedSize_ ||
+            h.dataOffset % alignof(Record) != 0) {
+            return "bad data offset";
+        }
+        if (h.count > (mappedSize_ - h.dataOffset) / sizeof(Record)) {
+            return "file is shorter than its element count";
+        }
+        return "";
+    }
+};
+
+// Streams records into a dataset file through a fixed buffer. Records are
+// copied byte for byte, so padding must already be zero (see fromColumns)
+template <typename T>
+class DatasetWriter {
+public:
+    DatasetWriter() = default;
+    ~DatasetWriter() { close(); }
+
+    DatasetWriter(const DatasetWriter&) = delete;
+    DatasetWriter& operator=(const DatasetWriter&) = delete;
+
+    bool open(const std::string& path) {
+        file_ = std::fopen(path.c_str(), "wb");
+        if (!file_) {
+            return false;
+        }
+        count_ = 0;
+        used_ = 0;
+        buffer_.resize(kBufferRecords);
+        DatasetHeader h = makeHeader<T>(0); // count is patched in close()
+        return std::fwrite(&h, sizeof(h), 1, file_) == 1;
+    }
+
+    bool append(const T& record) {
+        if (used_ == kBufferRecords && !flush()) {
+            return false;
+        }
+        std::memcpy(&buffer_[used_++], &record, sizeof(T)); // every byte, padding included
+        count_++;
+        return true;
+    }
+
+    bool append(Span<const T> records) {
+        for (const T& r : records) {
+            if (!append(r)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Writes the final header; returns false if anything failed to reach the file
+    bool close() {
+        if (!file_) {
+            return false;
+        }
+        bool ok = flush();
+        DatasetHeader h = makeHeader<T>(count_);
+        ok = ok && std::fseek(file_, 0, SEEK_SET) == 0 && std::fwrite(&h, sizeof(h), 1, file_) == 1;
+        ok = (std::fclose(file_) == 0) && ok;
+        file_ = nullptr;
+        return ok;
+    }
+
+    uint64_t count() const { return count_; }
+
+private:
+    static constexpr std::size_t kBufferRecords = (1 << 18) / sizeof(T) + 1; // ~256 KB
+    std::FILE* file_ = nullptr;
+    std::vector<T> buffer_; // on the heap, so a writer can live on the stack
+    std::size_t used_ = 0;
+    uint64_t count_ = 0;
+
+    bool flush() {
+        bool ok = used_ == 0 || std::fwrite(buffer_.data(), sizeof(T), used_, file_) == used_;
+        used_ = 0;
+        return ok;
+    }
+};
+
+/**
+ * CSV / whitespace-separated integer reader over an in-memory buffer
+ * (typically a mapped file). Fields are separated by commas, spaces or
+ * tabs; lines starting with '#' and lines without a digit (headers) are
+ * skipped. In the columns flagged by `letterColumns` a field may also be
+ * a single letter, read as that character's code, so job ids like "a"
+ * work ("abc" or "a7" is malformed). No allocation, no locale, no strtol.
+ */
+class CsvReader {
+public:
+    CsvReader(const char* data, std::size_t size) : pos_(data), end_(data + size) {}
+
+    // Parses the next record into `out`. Returns false at the end of input
+    // or on a malformed line (then bad() is true and line() tells where).
+    bool next(long long* out, std::size_t columns, uint32_t letterColumns = 0) {
+        while (pos_ < end_) {
+            line_++;
+            const char* lineEnd = static_cast<const char*>(std::memchr(pos_, '\n', end_ - pos_));
+            if (!lineEnd) {
+                lineEnd = end_;
+            }
+            const char* p = pos_;
+            pos_ = lineEnd + (lineEnd < end_);
+
+            if (skippable(p, lineEnd)) {
+                continue;
+            }
+            std::size_t got = 0;
+            while (got < columns) {
+                while (p < lineEnd && (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r')) p++;
+                if (p == lineEnd || !parseField(p, lineEnd, (letterColumns >> got) & 1, out[got])) {
+                    bad_ = true;
+                    return false;
+                }
+                got++;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    bool bad() const { return bad_; }
+    std::size_t line() const { return line_; }
+
+private:
+    const char* pos_;
+    const char* end_;
+    std::size_t line_ = 0;
+    bool bad_ = false;
+
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+    static bool isLetter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+    // Comments, blank lines and header lines carry no record
+    static bool skippable(const char* p, const char* lineEnd) {
+        while (p < lineEnd && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+        if (p == lineEnd || *p == '#') {
+            return true;
+        }
+        for (; p < lineEnd; p++) {
+            if (isDigit(*p)) return false;
+        }
+        return true;
+    }
+
+    static bool parseField(const char*& p, const char* lineEnd, bool letterAllowed, long long& value) {
+        if (letterAllowed && isLetter(*p)) {
+            // Exactly one letter: "abc" or "a7" is a typo, not id 'a'
+            value = static_cast<unsigned char>(*p);
+            p++;
+            return p == lineEnd || *p == ',' || *p == ' ' || *p == '\t' || *p == '\r';
+        }
+        bool negative = (*p == '-');
+        if (*p == '-' || *p == '+') p++;
+        if (p == lineEnd || !isDigit(*p)) {
+            return false;
+        }
+        const unsigned long long limit = 1ull << 62; // beyond any record field
+        unsigned long long v = 0;
+        while (p < lineEnd && isDigit(*p)) {
+            unsigned digit = static_cast<unsigned>(*p - '0');
+            if (v > (limit - digit) / 10) {
+                return false; // checked before multiplying, so v never wraps
+            }
+            v = v * 10 + digit;
+            p++;
+        }
+        value = negative ? -static_cast<long long>(v) : static_cast<long long>(v);
+        return p == lineEnd || *p == ',' || *p == ' ' || *p == '\t' || *p == '\r';
+    }
+};
+
+} // namespace dsa
+
+#endif // DSA_DATASET_H
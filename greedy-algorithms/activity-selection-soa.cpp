@@ -0,0 +1,294 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <climits>
+
+// Reuse Activity / selectActivities without pulling in their demo main()
+#ifdef DSA_NO_MAIN
+#include "activity-selection.cpp"
+#else
+#define DSA_NO_MAIN
+#include "activity-selection.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Activity Selection Engine for Very Large Inputs
+ *
+ * selectActivities() sorts an array of structs through a comparator
+ * function pointer and prints every pick with std::endl. This engine
+ * solves the same problem without any I/O:
+ * 1. Start/finish times live in separate arrays (structure of arrays)
+ * 2. If finish times are already non-decreasing, sorting is skipped
+ * 3. Otherwise a key-index radix sort orders activities by finish time.
+ *    Each activity becomes a 12-byte record (relative finish, index,
+ *    start), so the greedy loop never gathers from the input arrays.
+ *    One pass scatters the records into 2048 buckets by the top bits of
+ *    the finish time, through small write-combining buffers. Each bucket
+ *    then fits in L2 and is finished there with LSD passes on the low bits
+ * 4. The greedy loop is branch-free: every index is written to the
+ *    output and the count only advances when the activity is taken.
+ *    It runs bucket by bucket, right after each bucket is sorted
+ *
+ * Selected indices are written into a caller-provided buffer (size n).
+ * Time: O(n * passes), passes <= 3, Space: 12 bytes per activity of
+ * scratch, reused across calls
+ */
+class ActivitySelector {
+public:
+    /**
+     * Selects a maximum set of non-overlapping activities.
+     * An activity may start at the exact time the previous one finishes.
+     * Returns the number of indices written to `selected`.
+     */
+    size_t select(const int* start, const int* finish, size_t n, uint32_t* selected) {
+        if (n == 0) {
+            return 0;
+        }
+        if (isSortedByFinish(finish, n)) {
+            return greedySorted(start, finish, n, selected);
+        }
+        return selectBucketed(start, finish, n, selected);
+    }
+
+    // Splits an array of Activity into separate start/finish arrays
+    static void toArrays(const std::vector<Activity>& activities,
+                         std::vector<int>& start, std::vector<int>& finish) {
+        start.resize(activities.size());
+        finish.resize(activities.size());
+        for (size_t i = 0; i < activities.size(); i++) {
+            start[i] = activities[i].start;
+            finish[i] = activities[i].finish;
+        }
+    }
+
+private:
+    static constexpr int kDigitBits = 11;
+    static constexpr uint32_t kRadix = 1u << kDigitBits;
+    static constexpr uint32_t kBufferRecords = 16; // per bucket: 192 bytes, 3 cache lines
+
+    struct Record {
+        uint32_t finish; // finish - minimum finish
+        uint32_t index;
+        int start;
+    };
+
+    std::vector<Record> records_;      // bucketed by the top finish bits
+    std::vector<Record> bucketTmp_;    // LSD scratch, one bucket at a time
+    std::vector<Record> writeBuffer_;  // kBufferRecords per bucket
+    std::vector<uint32_t> bufferFill_;
+
+    static bool isSortedByFinish(const int* finish, size_t n) {
+        // No early exit: a single OR-reduction the compiler can vectorize
+        int unsorted = 0;
+        for (size_t i = 1; i < n; i++) {
+            unsorted |= finish[i] < finish[i - 1];
+        }
+        return unsorted == 0;
+    }
+
+    static size_t greedySorted(const int* start, const int* finish, size_t n, uint32_t* selected) {
+        size_t count = 0;
+        long long lastFinish = LLONG_MIN;
+        for (size_t i = 0; i < n; i++) {
+            bool take = start[i] >= lastFinish;
+            selected[count] = static_cast<uint32_t>(i);
+            count += take;
+            lastFinish = take ? finish[i] : lastFinish;
+        }
+        return count;
+    }
+
+    // Greedy over records in finish order; times are relative to minFinish
+    static size_t greedyRecords(const Record* records, size_t m, long long minFinish,
+                                uint32_t* selected, size_t count, long long& lastFinish) {
+        for (size_t k = 0; k < m; k++) {
+            bool take = records[k].start - minFinish >= lastFinish;
+            selected[count] = records[k].index;
+            count += take;
+            lastFinish = take ? static_cast<long long>(records[k].finish) : lastFinish;
+        }
+        return count;
+    }
+
+    // LSD radix sort of one bucket on its low `bits` finish bits.
+    // Returns wherever the sorted records ended up (the bucket or bucketTmp_).
+    const Record* sortBucket(Record* records, size_t m, int bits) {
+        if (bucketTmp_.size() < m) {
+            bucketTmp_.resize(m);
+        }
+        Record* from = records;
+        Record* to = bucketTmp_.data();
+        int passes = (bits + kDigitBits - 1) / kDigitBits;
+        int digitBits = (bits + passes - 1) / passes;
+        uint32_t mask = (1u << digitBits) - 1;
+        size_t count[kRadix];
+        for (int pass = 0; pass < passes; pass++) {
+            const int shift = pass * digitBits;
+            std::fill(count, count + mask + 1, 0);
+            for (size_t i = 0; i < m; i++) {
+                count[(from[i].finish >> shift) & mask]++;
+            }
+            size_t sum = 0;
+            for (uint32_t d = 0; d <= mask; d++) {
+                size_t c = count[d];
+                count[d] = sum;
+                sum += c;
+            }
+            for (size_t i = 0; i < m; i++) {
+                to[count[(from[i].finish >> shift) & mask]++] = from[i];
+            }
+            std::swap(from, to);
+        }
+        return from;
+    }
+
+    size_t selectBucketed(const int* start, const int* finish, size_t n, uint32_t* selected) {
+        int minF = finish[0], maxF = finish[0];
+        for (size_t i = 1; i < n; i++) {
+            minF = std::min(minF, finish[i]);
+            maxF = std::max(maxF, finish[i]);
+        }
+        const long long minFinish = minF;
+
+        // The top (up to) 11 bits of the finish range pick the bucket
+        uint32_t range = static_cast<uint32_t>(static_cast<long long>(maxF) - minF);
+        int bits = 0;
+        while (bits < 32 && (range >> bits) != 0) {
+            bits++;
+        }
+        const int lowBits = bits > kDigitBits ? bits - kDigitBits : 0;
+        const uint32_t buckets = (range >> lowBits) + 1;
+
+        std::vector<size_t> begin(buckets + 1, 0);
+        for (size_t i = 0; i < n; i++) {
+            begin[(static_cast<uint32_t>(finish[i] - minFinish) >> lowBits) + 1]++;
+        }
+        for (uint32_t b = 0; b < buckets; b++) {
+            begin[b + 1] += begin[b];
+        }
+
+        // Scatter through per-bucket buffers: whole cache lines reach memory
+        // at a time instead of one record to each of 2048 different pages
+        records_.resize(n);
+        writeBuffer_.resize(static_cast<size_t>(buckets) * kBufferRecords);
+        bufferFill_.assign(buckets, 0);
+        std::vector<size_t> next(begin.begin(), begin.end() - 1);
+        for (size_t i = 0; i < n; i++) {
+            uint32_t rel = static_cast<uint32_t>(finish[i] - minFinish);
+            uint32_t b = rel >> lowBits;
+            Record* buffer = &writeBuffer_[static_cast<size_t>(b) * kBufferRecords];
+            uint32_t fill = bufferFill_[b];
+            buffer[fill] = {rel, static_cast<uint32_t>(i), start[i]};
+            if (++fill == kBufferRecords) {
+                std::copy(buffer, buffer + kBufferRecords, &records_[next[b]]);
+                next[b] += kBufferRecords;
+                fill = 0;
+            }
+            bufferFill_[b] = fill;
+        }
+        for (uint32_t b = 0; b < buckets; b++) {
+            const Record* buffer = &writeBuffer_[static_cast<size_t>(b) * kBufferRecords];
+            std::copy(buffer, buffer + bufferFill_[b], &records_[next[b]]);
+        }
+
+        // Buckets are in finish order, so sort and consume them one at a time
+        size_t count = 0;
+        long long lastFinish = LLONG_MIN;
+        for (uint32_t b = 0; b < buckets; b++) {
+            size_t m = begin[b + 1] - begin[b];
+            const Record* sorted = &records_[begin[b]];
+            if (m > 1 && lowBits > 0) {
+                sorted = sortBucket(&records_[begin[b]], m, lowBits);
+            }
+            count = greedyRecords(sorted, m, minFinish, selected, count, lastFinish);
+        }
+        return count;
+    }
+};
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main(int argc, char* argv[]) {
+    std::cout << "--- Test Case 1: Same input as activity-selection.cpp ---\n";
+    std::vector<Activity> activities = {
+        {5, 9}, {1, 2}, {3, 4}, {0, 6},
+        {5, 7}, {8, 9}
+    };
+    std::vector<int> start, finish;
+    ActivitySelector::toArrays(activities, start, finish);
+    ActivitySelector selector;
+    std::vector<uint32_t> picked(activities.size());
+    size_t count = selector.select(start.data(), finish.data(), start.size(), picked.data());
+    std::cout << "Selected activities:";
+    for (size_t k = 0; k < count; k++) {
+        std::cout << " (" << start[picked[k]] << ", " << finish[picked[k]] << ")";
+    }
+    std::cout << "\n"; // Expected: (1, 2) (3, 4) (5, 7) (8, 9)
+    selectActivities(activities);
+
+    std::cout << "\n--- Test Case 2: Random input matches std::sort + greedy ---\n";
+    std::mt19937 rng(3);
+    const size_t m = 100000;
+    start.resize(m);
+    finish.resize(m);
+    for (size_t i = 0; i < m; i++) {
+        start[i] = static_cast<int>(rng() % 1000000) - 500000;
+        finish[i] = start[i] + static_cast<int>(rng() % 100) + 1;
+    }
+    std::vector<Activity> reference(m);
+    for (size_t i = 0; i < m; i++) {
+        reference[i] = {start[i], finish[i]};
+    }
+    std::sort(reference.begin(), reference.end(), compareActivities);
+    size_t expected = 1;
+    for (size_t j = 1, i = 0; j < m; j++) {
+        if (reference[j].start >= reference[i].finish) {
+            expected++;
+            i = j;
+        }
+    }
+    picked.resize(m);
+    count = selector.select(start.data(), finish.data(), m, picked.data());
+    std::cout << "Engine: " << count << ", reference: " << expected
+              << (count == expected ? " (match)" : " (MISMATCH)") << "\n";
+
+    // Usage: ./activity_selection_soa [n]   (default 100M intervals)
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    std::cout << "\n--- Benchmark: " << n << " intervals ---\n";
+    start.assign(n, 0);
+    finish.assign(n, 0);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t r = rng();
+        start[i] = static_cast<int>(r % 2000000000u);
+        finish[i] = start[i] + static_cast<int>((r >> 8) % 1000) + 1;
+    }
+    picked.assign(n, 0);
+
+    // The first call also page-faults the engine's scratch; later calls reuse it
+    ActivitySelector fresh;
+    auto t0 = std::chrono::steady_clock::now();
+    count = fresh.select(start.data(), finish.data(), n, picked.data());
+    double firstSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Unsorted input: " << count << " selected in " << firstSec << " s (first call)\n";
+    t0 = std::chrono::steady_clock::now();
+    count = fresh.select(start.data(), finish.data(), n, picked.data());
+    double unsortedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Unsorted input: " << count << " selected in " << unsortedSec << " s (scratch reused)\n";
+
+    // Intervals generated in finish order take the no-sort path
+    for (size_t i = 0; i < n; i++) {
+        finish[i] = static_cast<int>(i * 20);
+        start[i] = finish[i] - static_cast<int>(rng() % 50);
+    }
+    t0 = std::chrono::steady_clock::now();
+    size_t sortedCount = selector.select(start.data(), finish.data(), n, picked.data());
+    double sortedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Pre-sorted input: " << sortedCount << " selected in " << sortedSec << " s\n";
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
@@ -1,6 +1,11 @@
+// Include guard: several drivers may reuse this file in one program
+#ifndef DSA_ACTIVITY_SELECTION_CPP
+#define DSA_ACTIVITY_SELECTION_CPP
+
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include "../datasets/dataset-layout.h"
 
 // Represents an activity with a start and finish time
 struct Activity {
@@ -8,13 +13,27 @@ struct Activity {
     int finish;
 };
 
+// How an Activity is stored in a binary dataset; CSV columns: start, finish
+template <>
+struct dsa::DatasetLayout<Activity> {
+    static constexpr dsa::ElementType type = dsa::ElementType::Activity;
+    static constexpr std::size_t columns = 2;
+    static constexpr uint32_t letterColumns = 0;
+    static constexpr uint32_t offsets[] = {offsetof(Activity, start), offsetof(Activity, finish)};
+    static bool fromColumns(const long long* c, Activity& out) {
+        out = {static_cast<int>(c[0]), static_cast<int>(c[1])};
+        return out.start == c[0] && out.finish == c[1];
+    }
+};
+
 // Comparison function to sort activities by their finish time
 bool compareActivities(const Activity& a, const Activity& b) {
     return (a.finish < b.finish);
 }
 
 // Function to find the maximum number of non-overlapping activities
-void selectActivities(std::vector<Activity>& activities) {
+// Sorts `activities` in place (a vector or a copy-on-write dataset)
+void selectActivities(dsa::Span<Activity> activities) {
        if (activities.empty()) {
        std::cout << "No activities to select." << std::endl;
        return;
@@ -38,11 +57,30 @@ void selectActivities(std::vector<Activity>& activities) {
     }
 }
 
-int main() {
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+#include "../datasets/dataset.h"
+
+// Usage: activity_selection [activities.bin] (see datasets/README.md)
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        // Copy-on-write: sorting the activities never modifies the file
+        dsa::Dataset<Activity> data;
+        if (!data.open(argv[1])) {
+            std::cerr << "Cannot load " << argv[1] << ": " << data.error() << std::endl;
+            return 1;
+        }
+        selectActivities(data.elements());
+        return 0;
+    }
+
     std::vector<Activity> activities = {
         {5, 9}, {1, 2}, {3, 4}, {0, 6},
         {5, 7}, {8, 9}
     };
     selectActivities(activities);
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN
+
+#endif // DSA_ACTIVITY_SELECTION_CPP
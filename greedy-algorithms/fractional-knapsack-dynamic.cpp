@@ -0,0 +1,328 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdint>
+
+// Reuse Item / fractionalKnapsack without pulling in their demo main()
+#ifdef DSA_NO_MAIN
+#include "fractional-knapsack.cpp"
+#else
+#define DSA_NO_MAIN
+#include "fractional-knapsack.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Dynamic Fractional Knapsack (order-statistics treap)
+ *
+ * fractionalKnapsack() recomputes from scratch, which is hopeless when
+ * prices and weights change thousands of times per second. This keeps
+ * the items in a treap ordered by ratio (highest first), where every
+ * node also stores the weight and value sums of its subtree.
+ *
+ * Answering a capacity walks down once from the root:
+ * - the left subtree (better ratios) overflows the capacity -> go left
+ * - otherwise take all of it, then this item (whole or a fraction),
+ *   then continue right with what is left
+ *
+ * Ratios are compared exactly by cross-multiplying in 64 bits, with the
+ * node slot as a tie-break so every key is unique. Items with weight <= 0
+ * are rejected. Sums are 64-bit.
+ *
+ * Erased slots are reused. A handle is the slot plus the slot's generation
+ * (bumped on every erase), so a handle kept past erase() stays invalid
+ * instead of silently naming whichever item took the slot next.
+ *
+ * A Fenwick tree over ratio ranks would need every ratio up front; the
+ * treap handles ratios it has never seen before.
+ *
+ * Time: O(log n) expected for insert / erase / update / query
+ * Space: O(n)
+ */
+class DynamicFractionalKnapsack {
+public:
+    using Handle = uint64_t; // generation << 32 | slot
+    static constexpr Handle kInvalid = UINT64_MAX;
+
+    // Adds an item; returns kInvalid for items with weight <= 0
+    Handle insert(const Item& item) {
+        if (item.weight <= 0) {
+            return kInvalid;
+        }
+        int h;
+        if (!freeList_.empty()) {
+            h = freeList_.back();
+            freeList_.pop_back();
+            uint32_t generation = nodes_[h].generation;
+            nodes_[h] = Node();
+            nodes_[h].generation = generation;
+        } else {
+            h = static_cast<int>(nodes_.size());
+            nodes_.push_back(Node());
+        }
+        Node& n = nodes_[h];
+        n.value = item.value;
+        n.weight = item.weight;
+        n.priority = static_cast<uint32_t>(rng_());
+        n.live = true;
+        pull(h);
+
+        root_ = insertNode(root_, h);
+        count_++;
+        return static_cast<Handle>(n.generation) << 32 | static_cast<uint32_t>(h);
+    }
+
+    // Removes an item. Returns false for unknown or already erased handles.
+    bool erase(Handle handle) {
+        int h = slotOf(handle);
+        if (h == -1) {
+            return false;
+        }
+        root_ = eraseNode(root_, h);
+        nodes_[h].live = false;
+        nodes_[h].generation++;
+        freeList_.push_back(h);
+        count_--;
+        return true;
+    }
+
+    // Changes an item's value and weight; the handle stays valid
+    bool update(Handle handle, int value, int weight) {
+        int h = slotOf(handle);
+        if (h == -1 || weight <= 0) {
+            return false;
+        }
+        root_ = eraseNode(root_, h);
+        nodes_[h].value = value;
+        nodes_[h].weight = weight;
+        nodes_[h].left = nodes_[h].right = -1;
+        pull(h);
+        root_ = insertNode(root_, h);
+        return true;
+    }
+
+    // Maximum value for a knapsack of the given capacity
+    double query(long long capacity) const {
+        double total = 0.0;
+        int node = root_;
+        while (node != -1 && capacity > 0) {
+            const Node& n = nodes_[node];
+            if (n.left != -1) {
+                const Node& l = nodes_[n.left];
+                if (l.sumWeight > capacity) {
+                    node = n.left; // cutoff is among better ratios
+                    continue;
+                }
+                total += l.sumValue;
+                capacity -= l.sumWeight;
+            }
+            if (n.weight >= capacity) {
+                total += n.value * (static_cast<double>(capacity) / n.weight);
+                return total;
+            }
+            total += n.value;
+            capacity -= n.weight;
+            node = n.right;
+        }
+        return total;
+    }
+
+    size_t size() const { return count_; }
+    long long totalWeight() const { return root_ == -1 ? 0 : nodes_[root_].sumWeight; }
+
+private:
+    struct Node {
+        int left = -1, right = -1;
+        uint32_t priority = 0;
+        int value = 0, weight = 0;
+        long long sumValue = 0, sumWeight = 0;
+        uint32_t generation = 0;
+        bool live = false;
+    };
+
+    std::vector<Node> nodes_;
+    std::vector<int> freeList_;
+    int root_ = -1;
+    size_t count_ = 0;
+    std::mt19937 rng_{12345};
+
+    // Slot of a live handle, or -1 if the handle is unknown or stale
+    int slotOf(Handle handle) const {
+        uint32_t slot = static_cast<uint32_t>(handle);
+        if (slot >= nodes_.size() || !nodes_[slot].live || nodes_[slot].generation != handle >> 32) {
+            return -1;
+        }
+        return static_cast<int>(slot);
+    }
+
+    // True if node a comes before node b: higher ratio first, then lower handle
+    bool before(int a, int b) const {
+        long long lhs = static_cast<long long>(nodes_[a].value) * nodes_[b].weight;
+        long long rhs = static_cast<long long>(nodes_[b].value) * nodes_[a].weight;
+        return lhs != rhs ? lhs > rhs : a < b;
+    }
+
+    void pull(int node) {
+        Node& n = nodes_[node];
+        n.sumValue = n.value;
+        n.sumWeight = n.weight;
+        if (n.left != -1) {
+            n.sumValue += nodes_[n.left].sumValue;
+            n.sumWeight += nodes_[n.left].sumWeight;
+        }
+        if (n.right != -1) {
+            n.sumValue += nodes_[n.right].sumValue;
+            n.sumWeight += nodes_[n.right].sumWeight;
+        }
+    }
+
+    // left: nodes before `key`, right: `key` and everything after it
+    void split(int node, int key, int& left, int& right) {
+        if (node == -1) {
+            left = right = -1;
+            return;
+        }
+        if (before(node, key)) {
+            split(nodes_[node].right, key, nodes_[node].right, right);
+            left = node;
+        } else {
+            split(nodes_[node].left, key, left, nodes_[node].left);
+            right = node;
+        }
+        pull(node);
+    }
+
+    // Walks down to where h's priority belongs and splits only that subtree
+    int insertNode(int node, int h) {
+        if (node == -1) {
+            return h;
+        }
+        if (nodes_[h].priority > nodes_[node].priority) {
+            split(node, h, nodes_[h].left, nodes_[h].right);
+            pull(h);
+            return h;
+        }
+        if (before(h, node)) {
+            nodes_[node].left = insertNode(nodes_[node].left, h);
+        } else {
+            nodes_[node].right = insertNode(nodes_[node].right, h);
+        }
+        pull(node);
+        return node;
+    }
+
+    // Finds h by key and replaces it with the merge of its children
+    int eraseNode(int node, int h) {
+        if (node == h) {
+            return merge(nodes_[h].left, nodes_[h].right);
+        }
+        if (before(h, node)) {
+            nodes_[node].left = eraseNode(nodes_[node].left, h);
+        } else {
+            nodes_[node].right = eraseNode(nodes_[node].right, h);
+        }
+        pull(node);
+        return node;
+    }
+
+    int merge(int a, int b) {
+        if (a == -1) return b;
+        if (b == -1) return a;
+        if (nodes_[a].priority > nodes_[b].priority) {
+            nodes_[a].right = merge(nodes_[a].right, b);
+            pull(a);
+            return a;
+        }
+        nodes_[b].left = merge(a, nodes_[b].left);
+        pull(b);
+        return b;
+    }
+};
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << "--- Test Case 1: Same items as fractional-knapsack.cpp ---\n";
+    DynamicFractionalKnapsack knapsack;
+    auto h60 = knapsack.insert({60, 10});
+    auto h100 = knapsack.insert({100, 20});
+    knapsack.insert({120, 30});
+    std::cout << "Capacity 50: " << knapsack.query(50) << " (expected 240.00)\n";
+
+    knapsack.update(h60, 10, 10); // item becomes the worst ratio
+    std::cout << "After update (10, 10): " << knapsack.query(50) << " (expected 220.00)\n";
+    knapsack.erase(h100);
+    std::cout << "After erasing (100, 20): " << knapsack.query(50) << " (expected 130.00)\n";
+
+    std::cout << "\n--- Test Case 2: Stale handles are rejected ---\n";
+    auto h50 = knapsack.insert({50, 5}); // reuses the slot (100, 20) had
+    bool staleErase = knapsack.erase(h100);
+    bool staleUpdate = knapsack.update(h100, 1, 1);
+    std::cout << "Erase/update through the erased handle: " << (staleErase || staleUpdate ? "accepted" : "rejected")
+              << " (expected rejected)\n";
+    std::cout << "New item untouched: " << knapsack.query(5) << " (expected 50.00)\n";
+    knapsack.erase(h50);
+
+    std::cout << "\n--- Test Case 3: Random updates agree with fractionalKnapsack ---\n";
+    std::mt19937 rng(17);
+    DynamicFractionalKnapsack dyn;
+    std::vector<Item> live;
+    std::vector<DynamicFractionalKnapsack::Handle> handles;
+    bool allMatch = true;
+    for (int step = 0; step < 3000; step++) {
+        unsigned op = rng() % 4;
+        if (op == 0 && !live.empty()) {
+            size_t i = rng() % live.size();
+            dyn.erase(handles[i]);
+            live.erase(live.begin() + i);
+            handles.erase(handles.begin() + i);
+        } else if (op == 1 && !live.empty()) {
+            size_t i = rng() % live.size();
+            live[i] = {static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 50) + 1, 0.0};
+            dyn.update(handles[i], live[i].value, live[i].weight);
+        } else {
+            Item item = {static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 50) + 1, 0.0};
+            live.push_back(item);
+            handles.push_back(dyn.insert(item));
+        }
+        if (step % 25 == 0) {
+            int capacity = static_cast<int>(rng() % (dyn.totalWeight() + 20));
+            std::vector<Item> copy = live;
+            double expected = fractionalKnapsack(capacity, copy);
+            allMatch = allMatch && std::fabs(dyn.query(capacity) - expected) <= 1e-6 * std::max(1.0, expected);
+        }
+    }
+    std::cout << "All match: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Benchmark: 1M items under load ---\n";
+    const size_t n = 1000000;
+    DynamicFractionalKnapsack big;
+    std::vector<DynamicFractionalKnapsack::Handle> bigHandles(n);
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        bigHandles[i] = big.insert({static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 100) + 1, 0.0});
+    }
+    double buildSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Insert " << n << " items: " << buildSec << " s\n";
+
+    const int ops = 1000000;
+    double checksum = 0.0;
+    t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) {
+        auto h = bigHandles[rng() % n];
+        big.update(h, static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 100) + 1);
+        checksum += big.query(static_cast<long long>(rng() % big.totalWeight()));
+    }
+    double opsSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << ops << " update+query pairs: " << opsSec << " s ("
+              << std::setprecision(0) << ops / opsSec << " pairs/s, checksum " << checksum << ")\n";
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
@@ -0,0 +1,296 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdint>
+
+// Reuse Item / fractionalKnapsack without pulling in their demo main()
+#ifdef DSA_NO_MAIN
+#include "fractional-knapsack.cpp"
+#else
+#define DSA_NO_MAIN
+#include "fractional-knapsack.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Fractional Knapsack Capacity-Query Index
+ *
+ * When the same catalog is evaluated against many capacities, calling
+ * fractionalKnapsack() re-sorts the items every time. Sorting once is
+ * enough: with items in ratio order, the greedy answer for capacity C is
+ * "every item whose prefix weight fits, plus a fraction of the next one".
+ *
+ * Build: sort by ratio (descending), store prefix sums of weight and value
+ * Query: branchless binary search for the last prefix that fits, with both
+ *        possible next probes prefetched, then add the fractional tail item
+ * Batch: clamp the capacities to [0, total weight], radix-sort them
+ *        packed with their query index into 64-bit keys, then answer
+ *        them in one sweep; the cutoff gallops forward from the previous
+ *        capacity's instead of being searched from scratch. Faster than
+ *        single queries once the batch is large (see the benchmark)
+ *
+ * Items with weight <= 0 are skipped; sums are 64-bit.
+ *
+ * Time: O(n log n) build, O(log n) per query,
+ *       O(q + q log(n / q)) per batch (O(q log q) if keys do not fit 64 bits)
+ * Space: O(n)
+ */
+class FractionalKnapsackIndex {
+public:
+    explicit FractionalKnapsackIndex(const std::vector<Item>& items) {
+        std::vector<Item> sorted;
+        sorted.reserve(items.size());
+        for (const auto& item : items) {
+            if (item.weight > 0) {
+                sorted.push_back({item.value, item.weight, static_cast<double>(item.value) / item.weight});
+            }
+        }
+        std::sort(sorted.begin(), sorted.end(), compareItems);
+
+        const size_t n = sorted.size();
+        prefixWeight_.resize(n + 1);
+        prefixValue_.resize(n + 1);
+        weight_.resize(n);
+        value_.resize(n);
+        prefixWeight_[0] = 0;
+        prefixValue_[0] = 0;
+        for (size_t k = 0; k < n; k++) {
+            weight_[k] = sorted[k].weight;
+            value_[k] = sorted[k].value;
+            prefixWeight_[k + 1] = prefixWeight_[k] + sorted[k].weight;
+            prefixValue_[k + 1] = prefixValue_[k] + sorted[k].value;
+        }
+    }
+
+    // Maximum value for one capacity
+    double query(long long capacity) const {
+        if (capacity <= 0) {
+            return 0.0;
+        }
+        return answerAt(wholeItems(capacity), capacity);
+    }
+
+    // Answers every capacity; results come back in the same order as `capacities`
+    std::vector<double> queryBatch(const std::vector<long long>& capacities) const {
+        const size_t q = capacities.size();
+        std::vector<double> answers(q);
+        if (q == 0) {
+            return answers;
+        }
+
+        // Capacities outside [0, total weight] have the same answer as the bound,
+        // so clamping keeps the keys as narrow as the catalog allows
+        const long long total = prefixWeight_.back();
+        auto clamp = [total](long long c) { return c <= 0 ? 0 : std::min(c, total); };
+        const int indexBits = bitWidth(q - 1);
+        const int capacityBits = bitWidth(static_cast<uint64_t>(total));
+
+        size_t k = 0; // items taken whole so far; only moves forward
+        if (indexBits + capacityBits < 64) {
+            std::vector<uint64_t> keys(q);
+            for (size_t i = 0; i < q; i++) {
+                keys[i] = static_cast<uint64_t>(clamp(capacities[i])) << indexBits | i;
+            }
+            radixSort(keys, indexBits, indexBits + capacityBits);
+            const uint64_t indexMask = (1ull << indexBits) - 1;
+            for (uint64_t key : keys) {
+                long long capacity = static_cast<long long>(key >> indexBits);
+                k = gallop(k, capacity);
+                answers[key & indexMask] = answerAt(k, capacity);
+            }
+        } else {
+            std::vector<std::pair<long long, size_t>> sorted(q);
+            for (size_t i = 0; i < q; i++) {
+                sorted[i] = {clamp(capacities[i]), i};
+            }
+            std::sort(sorted.begin(), sorted.end());
+            for (const auto& [capacity, i] : sorted) {
+                k = gallop(k, capacity);
+                answers[i] = answerAt(k, capacity);
+            }
+        }
+        return answers;
+    }
+
+    size_t size() const { return weight_.size(); }
+
+private:
+    // Items in ratio order (one array per field) and their prefix sums
+    std::vector<long long> weight_, value_;
+    std::vector<long long> prefixWeight_, prefixValue_;
+
+    // Number of leading items that fit whole: largest k with prefixWeight_[k] <= capacity
+    size_t wholeItems(long long capacity) const {
+        const long long* base = prefixWeight_.data();
+        size_t len = prefixWeight_.size(); // prefixWeight_[0] = 0 always fits
+        while (len > 1) {
+            size_t half = len / 2;
+            // Both candidates for the next probe, so the load is in flight before the compare resolves
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+            base = (base[half] <= capacity) ? base + half : base;
+            len -= half;
+        }
+        return base - prefixWeight_.data();
+    }
+
+    // wholeItems(capacity) given that the first k items are known to fit:
+    // doubling steps from k, then a binary search inside the last step
+    size_t gallop(size_t k, long long capacity) const {
+        const size_t last = prefixWeight_.size() - 1;
+        size_t step = 1;
+        while (k + step <= last && prefixWeight_[k + step] <= capacity) {
+            k += step;
+            step *= 2;
+        }
+        size_t hi = std::min(k + step, last + 1); // prefixWeight_[hi] > capacity (or past the end)
+        while (hi - k > 1) {
+            size_t mid = k + (hi - k) / 2;
+            if (prefixWeight_[mid] <= capacity) {
+                k = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        return k;
+    }
+
+    // Bits needed to hold v (0 for v == 0)
+    static int bitWidth(uint64_t v) {
+        return v == 0 ? 0 : 64 - __builtin_clzll(v);
+    }
+
+    // Stable LSD radix sort of keys by bits [lowBit, highBit), 11 bits per pass
+    static void radixSort(std::vector<uint64_t>& keys, int lowBit, int highBit) {
+        const int digitBits = 11;
+        const size_t radix = size_t(1) << digitBits;
+        std::vector<uint64_t> tmp(keys.size());
+        std::vector<size_t> count(radix);
+        for (int shift = lowBit; shift < highBit; shift += digitBits) {
+            std::fill(count.begin(), count.end(), 0);
+            for (uint64_t key : keys) {
+                count[(key >> shift) & (radix - 1)]++;
+            }
+            size_t sum = 0;
+            for (size_t b = 0; b < radix; b++) {
+                size_t c = count[b];
+                count[b] = sum;
+                sum += c;
+            }
+            for (uint64_t key : keys) {
+                tmp[count[(key >> shift) & (radix - 1)]++] = key;
+            }
+            keys.swap(tmp);
+        }
+    }
+
+    double answerAt(size_t k, long long capacity) const {
+        double total = static_cast<double>(prefixValue_[k]);
+        if (k < weight_.size()) {
+            long long remaining = capacity - prefixWeight_[k];
+            total += value_[k] * (static_cast<double>(remaining) / weight_[k]);
+        }
+        return total;
+    }
+};
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << "--- Test Case 1: Same items as fractional-knapsack.cpp ---\n";
+    std::vector<Item> items = {
+        {60, 10},
+        {100, 20},
+        {120, 30}
+    };
+    FractionalKnapsackIndex index(items);
+    std::vector<long long> caps = {0, 5, 10, 30, 50, 60, 100};
+    std::vector<double> batch = index.queryBatch(caps);
+    for (size_t i = 0; i < caps.size(); i++) {
+        std::cout << "Capacity " << caps[i] << ": " << index.query(caps[i])
+                  << " (batch " << batch[i] << ")\n"; // capacity 50 -> 240.00
+    }
+
+    std::cout << "\n--- Test Case 2: Random capacities agree with fractionalKnapsack ---\n";
+    std::mt19937 rng(21);
+    std::vector<Item> catalog(500);
+    int totalWeight = 0;
+    for (auto& item : catalog) {
+        item = {static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 50) + 1, 0.0};
+        totalWeight += item.weight;
+    }
+    FractionalKnapsackIndex catalogIndex(catalog);
+    std::vector<long long> randomCaps(300);
+    for (auto& c : randomCaps) {
+        c = rng() % (totalWeight + 100);
+    }
+    std::vector<double> randomBatch = catalogIndex.queryBatch(randomCaps);
+    bool allMatch = true;
+    for (size_t i = 0; i < randomCaps.size(); i++) {
+        std::vector<Item> copy = catalog;
+        double expected = fractionalKnapsack(static_cast<int>(randomCaps[i]), copy);
+        double tolerance = 1e-6 * std::max(1.0, expected);
+        allMatch = allMatch && std::fabs(catalogIndex.query(randomCaps[i]) - expected) <= tolerance &&
+                   std::fabs(randomBatch[i] - expected) <= tolerance;
+    }
+    std::cout << "All match: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Test Case 3: Batch edge cases ---\n";
+    std::vector<long long> edgeCaps = {-5, 0, 1, 59, 60, 61, 1000000000000LL};
+    std::vector<double> edgeBatch = index.queryBatch(edgeCaps);
+    allMatch = true;
+    for (size_t i = 0; i < edgeCaps.size(); i++) {
+        allMatch = allMatch && edgeBatch[i] == index.query(edgeCaps[i]);
+    }
+    std::cout << "Negative / past-total capacities match query(): " << (allMatch ? "Yes" : "No") << "\n";
+    FractionalKnapsackIndex empty(std::vector<Item>{});
+    std::vector<double> emptyBatch = empty.queryBatch({-1, 0, 10});
+    std::cout << "Empty catalog: " << emptyBatch[0] + emptyBatch[1] + emptyBatch[2] << "\n"; // Expected: 0.00
+
+    std::cout << "\n--- Benchmark: 1M items ---\n";
+    const size_t n = 1000000;
+    std::vector<Item> many(n);
+    long long manyWeight = 0;
+    for (auto& item : many) {
+        item = {static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 100) + 1, 0.0};
+        manyWeight += item.weight;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    FractionalKnapsackIndex big(many);
+    double buildSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Build: " << buildSec << " s\n";
+
+    const size_t q = 10000000;
+    std::vector<long long> queries(q);
+    for (auto& c : queries) {
+        c = static_cast<long long>(rng() % static_cast<uint64_t>(manyWeight));
+    }
+
+    t0 = std::chrono::steady_clock::now();
+    double checksum = 0.0;
+    for (long long c : queries) {
+        checksum += big.query(c);
+    }
+    double singleSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    t0 = std::chrono::steady_clock::now();
+    std::vector<double> answers = big.queryBatch(queries);
+    double batchSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    double batchChecksum = std::accumulate(answers.begin(), answers.end(), 0.0);
+
+    std::cout << std::setprecision(0);
+    std::cout << "Single queries: " << q / singleSec << " queries/s\n";
+    std::cout << "Batch (radix sort + galloping sweep): " << q / batchSec << " queries/s\n";
+    std::cout << "Checksums " << (std::fabs(checksum - batchChecksum) <= 1e-6 * checksum ? "match" : "DIFFER")
+              << "\n";
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
@@ -0,0 +1,214 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdint>
+
+// Reuse Item / fractionalKnapsack without pulling in their demo main()
+#ifdef DSA_NO_MAIN
+#include "fractional-knapsack.cpp"
+#else
+#define DSA_NO_MAIN
+#include "fractional-knapsack.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Linear-Time Fractional Knapsack (weighted-median selection)
+ *
+ * fractionalKnapsack() sorts every item by ratio (O(n log n)) and
+ * reorders the caller's vector, although only the position of the
+ * capacity cutoff matters. This solver finds the critical ratio with
+ * quickselect-style partitioning instead:
+ * 1. Copy (ratio, weight, value) into a private work array
+ * 2. Pick a random pivot ratio and 3-way partition: higher / equal / lower
+ * 3. If the higher part alone overflows the knapsack, continue in it.
+ *    Otherwise take it whole, fill from the equal part, and continue in
+ *    the lower part with the remaining capacity
+ *
+ * Each step discards a constant fraction of the items on average, so the
+ * total work is O(n) expected. The caller's items are never modified.
+ *
+ * Weights are summed in 64 bits, so the int Item no longer overflows at
+ * large capacities, and Item64 handles 64-bit inputs. Partition weight
+ * sums saturate instead of wrapping: Item64 weights can add up past 2^63,
+ * and a saturated sum still compares correctly against the capacity.
+ * Items with weight <= 0 are skipped.
+ *
+ * Time: O(n) expected, Space: O(n)
+ */
+
+// Item with 64-bit value and weight
+struct Item64 {
+    long long value;
+    long long weight;
+};
+
+class FractionalKnapsackSelect {
+public:
+    template <typename ItemT>
+    static double solve(long long capacity, const std::vector<ItemT>& items) {
+        if (capacity <= 0 || items.empty()) {
+            return 0.0;
+        }
+
+        std::vector<Entry> work;
+        work.reserve(items.size());
+        for (const auto& item : items) {
+            if (item.weight > 0) {
+                long long value = item.value, weight = item.weight;
+                work.push_back({static_cast<double>(value) / weight, weight, value});
+            }
+        }
+
+        std::mt19937_64 rng(0x9E3779B97F4A7C15ull);
+        double totalValue = 0.0;
+        long long remaining = capacity;
+        size_t lo = 0, hi = work.size();
+
+        while (lo < hi && remaining > 0) {
+            double pivot = work[lo + rng() % (hi - lo)].ratio;
+
+            // Dutch national flag: [lo, gt) > pivot, [gt, eq) == pivot, [lt, hi) < pivot
+            size_t gt = lo, eq = lo, lt = hi;
+            uint64_t gtWeight = 0, eqWeight = 0;
+            double gtValue = 0.0, eqValue = 0.0;
+            while (eq < lt) {
+                const Entry& e = work[eq];
+                if (e.ratio > pivot) {
+                    gtWeight = addSaturating(gtWeight, e.weight);
+                    gtValue += e.value;
+                    std::swap(work[gt++], work[eq++]);
+                } else if (e.ratio < pivot) {
+                    std::swap(work[eq], work[--lt]);
+                } else {
+                    eqWeight = addSaturating(eqWeight, e.weight);
+                    eqValue += e.value;
+                    eq++;
+                }
+            }
+
+            if (gtWeight > static_cast<uint64_t>(remaining)) {
+                // The cutoff lies among the higher-ratio items (the pivot is not one of them)
+                hi = gt;
+                continue;
+            }
+
+            // Take every higher-ratio item whole
+            totalValue += gtValue;
+            remaining -= static_cast<long long>(gtWeight);
+
+            if (eqWeight >= static_cast<uint64_t>(remaining)) {
+                // Items with the pivot ratio fill the rest; any mix of them is worth the same
+                totalValue += pivot * static_cast<double>(remaining);
+                remaining = 0;
+                break;
+            }
+            totalValue += eqValue;
+            remaining -= static_cast<long long>(eqWeight);
+            lo = lt; // continue with the lower-ratio items
+        }
+        return totalValue;
+    }
+
+private:
+    struct Entry {
+        double ratio;
+        long long weight;
+        long long value;
+    };
+
+    // Weights are positive and below 2^63, so a sum of two never wraps twice;
+    // UINT64_MAX stands for "more than any capacity"
+    static uint64_t addSaturating(uint64_t sum, long long weight) {
+        uint64_t next = sum + static_cast<uint64_t>(weight);
+        return next < sum ? UINT64_MAX : next;
+    }
+};
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << "--- Test Case 1: Same input as fractional-knapsack.cpp ---\n";
+    int capacity = 50;
+    std::vector<Item> items = {
+        {60, 10},
+        {100, 20},
+        {120, 30}
+    };
+    std::cout << "Maximum value in Knapsack = " << FractionalKnapsackSelect::solve(capacity, items)
+              << " (expected 240.00)\n";
+    std::cout << "First item still (60, 10): "
+              << (items[0].value == 60 && items[0].weight == 10 ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Test Case 2: 64-bit weights and values ---\n";
+    std::vector<Item64> big64 = {
+        {6000000000000LL, 3000000000LL},   // ratio 2000
+        {4000000000000LL, 4000000000LL},   // ratio 1000
+        {9000000000000LL, 3000000000LL}    // ratio 3000
+    };
+    std::cout << "Capacity 5e9: " << FractionalKnapsackSelect::solve(5000000000LL, big64)
+              << " (expected 13000000000000.00)\n";
+
+    std::cout << "\n--- Test Case 3: Total weight past 2^63 ---\n";
+    const long long w = 3000000000000000000LL; // 3e18; four of them exceed 2^63
+    std::vector<Item64> heavy = {
+        {3 * w, w},       // ratio 3
+        {w, w},           // ratio 1
+        {2 * w, w},       // ratio 2
+        {w / 1000, w}     // ratio 0.001
+    };
+    std::cout << std::scientific << std::setprecision(6);
+    std::cout << "Capacity 4.5e18: " << FractionalKnapsackSelect::solve(w / 2 * 3, heavy)
+              << " (expected 1.200000e+19)\n";
+    std::cout << "Capacity 2^63-1: " << FractionalKnapsackSelect::solve(INT64_MAX, heavy)
+              << " (expected 1.800022e+19)\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << "\n--- Test Case 4: Random inputs agree with the sort-based version ---\n";
+    std::mt19937 rng(9);
+    bool allMatch = true;
+    for (int trial = 0; trial < 200; trial++) {
+        std::vector<Item> random(1 + rng() % 200);
+        int totalWeight = 0;
+        for (auto& item : random) {
+            item = {static_cast<int>(rng() % 100) + 1, static_cast<int>(rng() % 20) + 1, 0.0};
+            totalWeight += item.weight;
+        }
+        int cap = static_cast<int>(rng() % (totalWeight + 10));
+        double fast = FractionalKnapsackSelect::solve(cap, random);
+        double sorted = fractionalKnapsack(cap, random);
+        allMatch = allMatch && std::fabs(fast - sorted) <= 1e-6 * std::max(1.0, sorted);
+    }
+    std::cout << "All match: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Benchmark: 10M items ---\n";
+    const size_t n = 10000000;
+    std::vector<Item> many(n);
+    long long totalWeight = 0;
+    for (auto& item : many) {
+        item = {static_cast<int>(rng() % 1000) + 1, static_cast<int>(rng() % 100) + 1, 0.0};
+        totalWeight += item.weight;
+    }
+    int cap = static_cast<int>(totalWeight / 2);
+
+    auto t0 = std::chrono::steady_clock::now();
+    double fast = FractionalKnapsackSelect::solve(cap, many);
+    double fastSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::vector<Item> copy = many; // fractionalKnapsack reorders its input
+    t0 = std::chrono::steady_clock::now();
+    double sorted = fractionalKnapsack(cap, copy);
+    double sortSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::cout << "Selection: " << fast << " in " << fastSec << " s\n";
+    std::cout << "Sort-based: " << sorted << " in " << sortSec << " s\n";
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
@@ -1,7 +1,12 @@
+// Include guard: several drivers may reuse this file in one program
+#ifndef DSA_FRACTIONAL_KNAPSACK_CPP
+#define DSA_FRACTIONAL_KNAPSACK_CPP
+
 #include <iostream>
 #include <vector>
 #include <algorithm>
 #include <iomanip>
+#include "../datasets/dataset-layout.h"
 
 // Represents an item with a value and a weight
 struct Item {
@@ -10,13 +15,27 @@ struct Item {
     double ratio; // value / weight
 };
 
+// How an Item is stored in a binary dataset; CSV columns: value, weight
+template <>
+struct dsa::DatasetLayout<Item> {
+    static constexpr dsa::ElementType type = dsa::ElementType::Item;
+    static constexpr std::size_t columns = 2;
+    static constexpr uint32_t letterColumns = 0;
+    static constexpr uint32_t offsets[] = {offsetof(Item, value), offsetof(Item, weight), offsetof(Item, ratio)};
+    static bool fromColumns(const long long* c, Item& out) {
+        out = {static_cast<int>(c[0]), static_cast<int>(c[1]), 0.0};
+        return out.value == c[0] && out.weight == c[1];
+    }
+};
+
 // Comparison function to sort items by their value-to-weight ratio
 bool compareItems(const Item& a, const Item& b) {
     return a.ratio > b.ratio;
 }
 
 // Function to solve the Fractional Knapsack problem
-double fractionalKnapsack(int capacity, std::vector<Item>& items) {
+// Sorts `items` in place (a vector or a copy-on-write dataset)
+double fractionalKnapsack(int capacity, dsa::Span<Item> items) {
       if (capacity <= 0) {
       return 0.0;
    }
@@ -55,7 +74,25 @@ double fractionalKnapsack(int capacity, std::vector<Item>& items) {
     return totalValue;
 }
 
-int main() {
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+#include <cstdlib>
+#include "../datasets/dataset.h"
+
+// Usage: fractional_knapsack [items.bin capacity] (see datasets/README.md)
+int main(int argc, char* argv[]) {
+    if (argc > 2) {
+        // Copy-on-write: sorting the items never modifies the file
+        dsa::Dataset<Item> data;
+        if (!data.open(argv[1])) {
+            std::cerr << "Cannot load " << argv[1] << ": " << data.error() << std::endl;
+            return 1;
+        }
+        double best = fractionalKnapsack(std::atoi(argv[2]), data.elements());
+        std::cout << "Maximum value in Knapsack = " << std::fixed << std::setprecision(2) << best << std::endl;
+        return 0;
+    }
+
     int capacity = 50;
     std::vector<Item> items = {
         {60, 10},
@@ -66,4 +103,7 @@ int main() {
     double maxValue = fractionalKnapsack(capacity, items);
     std::cout << "Maximum value in Knapsack = " << std::fixed << std::setprecision(2) << maxValue << std::endl;
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN
+
+#endif // DSA_FRACTIONAL_KNAPSACK_CPP
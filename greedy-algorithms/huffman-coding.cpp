@@ -1,9 +1,19 @@
+// Include guard: several drivers may reuse this file in one program
+#ifndef DSA_HUFFMAN_CODING_CPP
+#define DSA_HUFFMAN_CODING_CPP
+
 #include <iostream>
 #include <vector>
 #include <queue>
 #include <string>
 #include <memory> // Required for smart pointers
 
+// Profiling hooks (see benchmarks/perf-counters.h); no-ops unless that header is included first
+#ifndef DSA_PERF_REGION
+#define DSA_PERF_REGION(name, elements)
+#define DSA_PERF_REGION_IF(condition, name, elements)
+#endif
+
 // A node in the Huffman Tree, now using smart pointers
 struct MinHeapNode {
     char data;
@@ -58,36 +68,47 @@ void huffmanCoding(const std::vector<char>& data, const std::vector<int>& freq)
     // The priority queue now stores shared pointers to nodes
     std::priority_queue<std::shared_ptr<MinHeapNode>, std::vector<std::shared_ptr<MinHeapNode>>, compare> minHeap;
 
-    for (size_t i = 0; i < data.size(); ++i) {
-        // Use std::make_shared instead of `new`
-        minHeap.push(std::make_shared<MinHeapNode>(data[i], freq[i]));
+    {
+        DSA_PERF_REGION("huffman/build-heap", data.size());
+        for (size_t i = 0; i < data.size(); ++i) {
+            // Use std::make_shared instead of `new`
+            minHeap.push(std::make_shared<MinHeapNode>(data[i], freq[i]));
+        }
     }
 
     // --- 3. Build the Huffman Tree ---
-    while (minHeap.size() != 1) {
-        // Extract the two minimum frequency items
-        auto left = minHeap.top();
-        minHeap.pop();
-        auto right = minHeap.top();
-        minHeap.pop();
-
-        // Create a new internal node.
-        // Its frequency is the sum of the two nodes' frequencies.
-        auto top = std::make_shared<MinHeapNode>('\0', left->freq + right->freq, false);
-        top->left = left;
-        top->right = right;
-        minHeap.push(top);
+    {
+        DSA_PERF_REGION("huffman/build-tree", data.size());
+        while (minHeap.size() != 1) {
+            // Extract the two minimum frequency items
+            auto left = minHeap.top();
+            minHeap.pop();
+            auto right = minHeap.top();
+            minHeap.pop();
+
+            // Create a new internal node.
+            // Its frequency is the sum of the two nodes' frequencies.
+            auto top = std::make_shared<MinHeapNode>('\0', left->freq + right->freq, false);
+            top->left = left;
+            top->right = right;
+            minHeap.push(top);
+        }
     }
 
     // --- 4. Print Codes and Cleanup ---
     // The root of the tree is the last remaining node
     auto root = minHeap.top();
-    printCodes(root, "");
+    {
+        DSA_PERF_REGION("huffman/assign-codes", data.size());
+        printCodes(root, "");
+    }
 
     // No manual cleanup needed!
     // Smart pointers automatically deallocate memory when they go out of scope.
 }
 
+// Define DSA_NO_MAIN to reuse huffmanCoding from another driver
+#ifndef DSA_NO_MAIN
 int main() {
     std::cout << "--- Test Case 1: Valid Input ---\n";
     std::vector<char> data1 = {'a', 'b', 'c', 'd', 'e', 'f'};
@@ -105,4 +126,7 @@ int main() {
     huffmanCoding(data3, freq3);
 
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN
+
+#endif // DSA_HUFFMAN_CODING_CPP
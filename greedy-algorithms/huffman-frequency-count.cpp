@@ -0,0 +1,382 @@
+#include <iostream>
+#include <vector>
+#include <array>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Reuse MinHeapNode / huffmanCoding without pulling in its demo main()
+#ifdef DSA_NO_MAIN
+#include "huffman-coding.cpp"
+#else
+#define DSA_NO_MAIN
+#include "huffman-coding.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Symbol Histogram Stage for Huffman Coding
+ *
+ * huffmanCoding() expects precomputed data/freq vectors. On real inputs the
+ * frequency count is a full pass over the data and usually dominates, so
+ * this file provides a fast counting stage that feeds it directly:
+ * 1. Naive single-table count (baseline)
+ * 2. Interleaved sub-histograms - four tables so runs of the same byte do
+ *    not serialize on one counter's store -> load dependency
+ * 3. Sampled count - reads evenly spaced blocks and scales up (estimate)
+ * 4. Multi-threaded count - interleaved count per thread, merged at the end
+ *
+ * Input can be any in-memory buffer or a file mapped with MappedFile.
+ * Linux/POSIX only (mmap).
+ */
+
+using ByteCounts = std::array<uint64_t, 256>;
+
+class ByteHistogram {
+public:
+    /**
+     * Naive count - one table, one increment per byte
+     * Time: O(n), Space: O(1)
+     */
+    static ByteCounts countNaive(const unsigned char* buf, size_t n) {
+        ByteCounts counts{};
+        for (size_t i = 0; i < n; i++) {
+            counts[buf[i]]++;
+        }
+        return counts;
+    }
+
+    /**
+     * Interleaved count - byte i goes to sub-histogram (i % 4), so four
+     * consecutive equal bytes hit four different counters.
+     * Sub-histograms use 32-bit counters and are flushed into the 64-bit
+     * result every kFlushBytes so they can never overflow.
+     * Time: O(n), Space: O(1) (4 KB of tables)
+     */
+    static ByteCounts countInterleaved(const unsigned char* buf, size_t n) {
+        ByteCounts counts{};
+        uint32_t sub[4][256];
+
+        size_t pos = 0;
+        while (pos < n) {
+            size_t blockEnd = pos + std::min(n - pos, kFlushBytes);
+            std::memset(sub, 0, sizeof(sub));
+
+            // Main loop: 16 bytes per iteration, loaded as two 64-bit words
+            for (; pos + 16 <= blockEnd; pos += 16) {
+                uint64_t w0, w1;
+                std::memcpy(&w0, buf + pos, 8);
+                std::memcpy(&w1, buf + pos + 8, 8);
+                for (int b = 0; b < 64; b += 32) {
+                    sub[0][(w0 >> b) & 0xFF]++;
+                    sub[1][(w0 >> (b + 8)) & 0xFF]++;
+                    sub[2][(w0 >> (b + 16)) & 0xFF]++;
+                    sub[3][(w0 >> (b + 24)) & 0xFF]++;
+                    sub[0][(w1 >> b) & 0xFF]++;
+                    sub[1][(w1 >> (b + 8)) & 0xFF]++;
+                    sub[2][(w1 >> (b + 16)) & 0xFF]++;
+                    sub[3][(w1 >> (b + 24)) & 0xFF]++;
+                }
+            }
+            // Tail of the block
+            for (; pos < blockEnd; pos++) {
+                sub[pos & 3][buf[pos]]++;
+            }
+
+            // Merge the sub-histograms into the 64-bit result
+            for (int s = 0; s < 256; s++) {
+                counts[s] += uint64_t(sub[0][s]) + sub[1][s] + sub[2][s] + sub[3][s];
+            }
+        }
+        return counts;
+    }
+
+    /**
+     * Sampled count - counts one block out of every `stride` blocks and
+     * scales the result by n / sampledBytes. Whole blocks keep the reads
+     * sequential. Every symbol that appears in a sampled block gets a
+     * count of at least 1, but rare symbols may be missed entirely.
+     * Time: O(n / stride), Space: O(1)
+     */
+    static ByteCounts countSampled(const unsigned char* buf, size_t n,
+                                   size_t stride, size_t blockBytes = 4096) {
+        if (stride <= 1 || n <= blockBytes * stride) {
+            return countInterleaved(buf, n);
+        }
+
+        ByteCounts sampled{};
+        size_t sampledBytes = 0;
+        for (size_t pos = 0; pos < n; pos += blockBytes * stride) {
+            size_t len = std::min(blockBytes, n - pos);
+            ByteCounts part = countInterleaved(buf + pos, len);
+            for (int s = 0; s < 256; s++) {
+                sampled[s] += part[s];
+            }
+            sampledBytes += len;
+        }
+
+        // Scale up to an estimate for the whole buffer
+        ByteCounts estimate{};
+        double scale = static_cast<double>(n) / sampledBytes;
+        for (int s = 0; s < 256; s++) {
+            if (sampled[s] > 0) {
+                estimate[s] = std::max<uint64_t>(1, static_cast<uint64_t>(sampled[s] * scale + 0.5));
+            }
+        }
+        return estimate;
+    }
+
+    /**
+     * Multi-threaded count - splits the buffer into one contiguous range
+     * per thread, counts each range with countInterleaved and merges the
+     * per-thread tables at the end (no shared counters while counting).
+     * Time: O(n / threads + 256 * threads), Space: O(threads)
+     */
+    static ByteCounts countParallel(const unsigned char* buf, size_t n, unsigned threads) {
+        if (threads <= 1 || n < kMinBytesPerThread * 2) {
+            return countInterleaved(buf, n);
+        }
+        threads = static_cast<unsigned>(std::min<size_t>(threads, n / kMinBytesPerThread));
+
+        std::vector<ByteCounts> partial(threads);
+        std::vector<std::thread> workers;
+        size_t chunk = (n / threads + 63) & ~size_t(63); // cache-line aligned split
+
+        for (unsigned t = 0; t < threads; t++) {
+            size_t begin = std::min(n, t * chunk);
+            size_t end = (t + 1 == threads) ? n : std::min(n, begin + chunk);
+            workers.emplace_back([&partial, buf, begin, end, t]() {
+                partial[t] = countInterleaved(buf + begin, end - begin);
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+
+        ByteCounts counts{};
+        for (const auto& part : partial) {
+            for (int s = 0; s < 256; s++) {
+                counts[s] += part[s];
+            }
+        }
+        return counts;
+    }
+
+private:
+    // 32-bit sub-counters hold at most kFlushBytes / 4 hits each
+    static constexpr size_t kFlushBytes = size_t(1) << 30;
+    static constexpr size_t kMinBytesPerThread = size_t(1) << 16;
+};
+
+/**
+ * Read-only memory mapping of a whole file (RAII).
+ * The mapping is advised as sequential so the kernel reads ahead.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* p = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                ::madvise(p, st.st_size, MADV_SEQUENTIAL);
+                data_ = static_cast<const unsigned char*>(p);
+                size_ = static_cast<size_t>(st.st_size);
+            }
+        }
+        ::close(fd); // the mapping stays valid after close
+    }
+
+    ~MappedFile() {
+        if (data_) {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool valid() const { return data_ != nullptr; }
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * Converts a byte histogram into the data/freq vectors huffmanCoding takes.
+ * - Symbols with a zero count are dropped
+ * - '$' is reserved by huffmanCoding, so it is dropped (and reported)
+ * - Counts are scaled down if needed (non-zero stays >= 1) so that each
+ *   fits in int and their sum fits in the unsigned MinHeapNode::freq,
+ *   which holds the total at the root of the tree
+ */
+void toHuffmanInput(const ByteCounts& counts, std::vector<char>& data, std::vector<int>& freq) {
+    data.clear();
+    freq.clear();
+
+    uint64_t maxCount = 0;
+    uint64_t total = 0;
+    for (uint64_t c : counts) {
+        maxCount = std::max(maxCount, c);
+        total += c;
+    }
+    // Rounding a count up to 1 adds at most 1 per symbol, hence the 256 of headroom
+    const uint64_t sumLimit = UINT_MAX - 256;
+    uint64_t divisor = 1;
+    if (maxCount > INT_MAX) {
+        divisor = (maxCount + INT_MAX - 1) / INT_MAX;
+    }
+    if (total > sumLimit) {
+        divisor = std::max(divisor, (total + sumLimit - 1) / sumLimit);
+    }
+
+    for (int s = 0; s < 256; s++) {
+        if (counts[s] == 0) {
+            continue;
+        }
+        if (s == '$') {
+            std::cerr << "Note: dropping reserved symbol '$' (" << counts[s] << " occurrences).\n";
+            continue;
+        }
+        data.push_back(static_cast<char>(s));
+        freq.push_back(static_cast<int>(std::max<uint64_t>(1, counts[s] / divisor)));
+    }
+}
+
+// --- Benchmark helpers ---
+
+// Skewed input: ~90% of bytes are 'e', the rest spread over a few letters
+std::vector<unsigned char> makeSkewed(size_t n, uint32_t seed) {
+    std::vector<unsigned char> buf(n);
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t r = rng();
+        buf[i] = (r % 10 != 0) ? 'e' : static_cast<unsigned char>('a' + (r >> 8) % 8);
+    }
+    return buf;
+}
+
+// Uniform input: every byte value equally likely
+std::vector<unsigned char> makeUniform(size_t n, uint32_t seed) {
+    std::vector<unsigned char> buf(n);
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i + 4 <= n; i += 4) {
+        uint32_t r = rng();
+        std::memcpy(&buf[i], &r, 4);
+    }
+    return buf;
+}
+
+template <typename Fn>
+double measureGBps(const std::vector<unsigned char>& buf, Fn count, int runs = 3) {
+    double best = 1e100;
+    uint64_t sink = 0;
+    for (int r = 0; r < runs; r++) {
+        auto start = std::chrono::steady_clock::now();
+        ByteCounts c = count(buf.data(), buf.size());
+        auto stop = std::chrono::steady_clock::now();
+        sink += c[buf[0]];
+        best = std::min(best, std::chrono::duration<double>(stop - start).count());
+    }
+    if (sink == 0) {
+        std::cerr << "unexpected empty histogram\n";
+    }
+    return buf.size() / best / 1e9;
+}
+
+void benchmark(const std::string& name, const std::vector<unsigned char>& buf, unsigned threads) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << name << " (" << buf.size() / (1 << 20) << " MB):\n";
+    std::cout << "  naive:        " << measureGBps(buf, ByteHistogram::countNaive) << " GB/s\n";
+    std::cout << "  interleaved:  " << measureGBps(buf, ByteHistogram::countInterleaved) << " GB/s\n";
+    std::cout << "  parallel x" << threads << ":  "
+              << measureGBps(buf, [threads](const unsigned char* b, size_t n) {
+                     return ByteHistogram::countParallel(b, n, threads);
+                 })
+              << " GB/s\n";
+    std::cout << "  sampled 1/16: "
+              << measureGBps(buf, [](const unsigned char* b, size_t n) {
+                     return ByteHistogram::countSampled(b, n, 16);
+                 })
+              << " GB/s (estimate)\n";
+}
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main(int argc, char* argv[]) {
+    // Usage: ./huffman_frequency_count [file]   - count a file and print its codes
+    //        ./huffman_frequency_count           - demo + GB/s benchmark
+    if (argc > 1) {
+        MappedFile file(argv[1]);
+        if (!file.valid()) {
+            std::cerr << "Error: cannot map " << argv[1] << "\n";
+            return 1;
+        }
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        ByteCounts counts = ByteHistogram::countParallel(file.data(), file.size(), threads);
+
+        std::vector<char> data;
+        std::vector<int> freq;
+        toHuffmanInput(counts, data, freq);
+        huffmanCoding(data, freq);
+        return 0;
+    }
+
+    std::cout << "--- Test Case 1: Histogram -> huffmanCoding ---\n";
+    std::string text = "aaaaabbbbbbbbbccccccccccccdddddddddddddeeeeeeeeeeeeeeeefffffffffffffffffffffffffffffffffffffffffffff";
+    auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    ByteCounts counts = ByteHistogram::countInterleaved(bytes, text.size());
+    std::vector<char> data;
+    std::vector<int> freq;
+    toHuffmanInput(counts, data, freq);
+    huffmanCoding(data, freq); // same frequencies as huffman-coding.cpp Test Case 1
+
+    std::cout << "\n--- Test Case 2: All strategies agree ---\n";
+    std::vector<unsigned char> check = makeSkewed(1 << 20, 7);
+    ByteCounts naive = ByteHistogram::countNaive(check.data(), check.size());
+    bool same = naive == ByteHistogram::countInterleaved(check.data(), check.size()) &&
+                naive == ByteHistogram::countParallel(check.data(), check.size(), 4);
+    std::cout << "Interleaved/parallel match naive: " << (same ? "Yes" : "No") << "\n";
+    ByteCounts estimate = ByteHistogram::countSampled(check.data(), check.size(), 8);
+    std::cout << "Sampled estimate for 'e': " << estimate['e'] << " (exact " << naive['e'] << ")\n";
+
+    std::cout << "\n--- Test Case 3: Counts of a file over 4 GiB ---\n";
+    ByteCounts huge{};
+    for (int s = 'a'; s < 'a' + 8; s++) {
+        huge[s] = (uint64_t(3) << 30) + s; // 8 x 3 GiB, each fits in int after scaling
+    }
+    huge['z'] = 1;
+    toHuffmanInput(huge, data, freq);
+    uint64_t rootFreq = 0;
+    for (int f : freq) {
+        rootFreq += f;
+    }
+    std::cout << "Root frequency fits in unsigned: " << (rootFreq <= UINT_MAX ? "Yes" : "No")
+              << " (" << rootFreq << ")\n";
+    std::cout << "Rare symbol kept: " << (freq.back() >= 1 ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Benchmark ---\n";
+    size_t n = size_t(64) << 20;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    benchmark("Skewed", makeSkewed(n, 1), threads);
+    benchmark("Uniform", makeUniform(n, 2), threads);
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
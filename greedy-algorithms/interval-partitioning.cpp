@@ -0,0 +1,303 @@
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+
+// Reuse Activity / compareActivities without pulling in their demo main()
+#ifdef DSA_NO_MAIN
+#include "activity-selection.cpp"
+#else
+#define DSA_NO_MAIN
+#include "activity-selection.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Interval Partitioning and k-Resource Activity Scheduling
+ *
+ * selectActivities() picks the largest non-overlapping set for ONE
+ * resource. Two related problems on the same Activity struct:
+ *
+ * 1. minResources - assign every activity to the fewest resources
+ *    (rooms / machines). Activities are radix-sorted by finish, and that
+ *    order is radix-sorted (stably) by start, giving (start, finish)
+ *    order; the two are swept together. A finish at time t is handled
+ *    before a start at t, so back-to-back activities share a resource,
+ *    and a zero-length (t, t) is placed before the other starts at t, so
+ *    it hands its resource straight back to them. Freed
+ *    resources go on a stack, so no heap is needed: every free resource
+ *    is interchangeable once the events are in time order.
+ *    Time: O(n) after the O(n) radix sort, Space: O(n)
+ *
+ * 2. kResources - with exactly k resources, schedule as many activities
+ *    as possible. Greedy by finish time; each activity goes to the
+ *    resource whose last finish is the latest one <= its start (best
+ *    fit), or is skipped if none is free.
+ *    Time: O(n log k), Space: O(n + k)
+ *
+ * Activities with finish < start are invalid and left unassigned (-1).
+ * As in selectActivities, an activity may start when another finishes.
+ */
+
+// resource[i] = resource assigned to activity i, or -1 if not scheduled
+struct Partition {
+    std::vector<int> resource;
+    int resourcesUsed = 0;
+    size_t scheduled = 0;
+};
+
+class IntervalPartitioner {
+public:
+    static Partition minResources(const std::vector<Activity>& activities) {
+        const size_t n = activities.size();
+        Partition result;
+        result.resource.assign(n, -1);
+
+        std::vector<uint32_t> ids;
+        ids.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            if (activities[i].finish >= activities[i].start) {
+                ids.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        // Stable sort by start over the finish order: (start, finish) order
+        std::vector<uint32_t> byFinish = sortByTime(activities, ids, false);
+        std::vector<uint32_t> byStart = sortByTime(activities, byFinish, true);
+
+        std::vector<int> freeStack;
+        size_t f = 0;
+        for (uint32_t idx : byStart) {
+            int startTime = activities[idx].start;
+            // Release everything that finished at or before this start
+            // (zero-length activities release their resource immediately below)
+            while (f < byFinish.size() && activities[byFinish[f]].finish <= startTime) {
+                const Activity& done = activities[byFinish[f]];
+                if (done.finish != done.start) {
+                    freeStack.push_back(result.resource[byFinish[f]]);
+                }
+                f++;
+            }
+            int room;
+            if (freeStack.empty()) {
+                room = result.resourcesUsed++;
+            } else {
+                room = freeStack.back();
+                freeStack.pop_back();
+            }
+            result.resource[idx] = room;
+            if (activities[idx].finish == startTime) {
+                freeStack.push_back(room);
+            }
+        }
+        result.scheduled = ids.size();
+        return result;
+    }
+
+    static Partition kResources(const std::vector<Activity>& activities, int k) {
+        const size_t n = activities.size();
+        Partition result;
+        result.resource.assign(n, -1);
+        if (k <= 0) {
+            return result;
+        }
+
+        std::vector<uint32_t> ids;
+        ids.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            if (activities[i].finish >= activities[i].start) {
+                ids.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        std::vector<uint32_t> byFinish = sortByTime(activities, ids, false);
+
+        // (last finish, resource) for every resource that has been used
+        std::multiset<std::pair<int, int>> busy;
+        for (uint32_t idx : byFinish) {
+            const Activity& a = activities[idx];
+            // Best fit: the resource that became free most recently, but not after a.start
+            auto it = busy.upper_bound({a.start, INT_MAX});
+            int room;
+            if (it != busy.begin()) {
+                --it;
+                room = it->second;
+                busy.erase(it);
+            } else if (result.resourcesUsed < k) {
+                room = result.resourcesUsed++;
+            } else {
+                continue; // Every resource is still busy
+            }
+            busy.insert({a.finish, room});
+            result.resource[idx] = room;
+            result.scheduled++;
+        }
+        return result;
+    }
+
+private:
+    /**
+     * Stable LSD radix sort of `ids` by start or finish time.
+     * Keys are (time - minTime) << 32 | index; only the digits the time
+     * range needs are sorted (three 11-bit passes at most).
+     */
+    static std::vector<uint32_t> sortByTime(const std::vector<Activity>& activities,
+                                            const std::vector<uint32_t>& ids, bool byStart) {
+        const size_t m = ids.size();
+        std::vector<uint32_t> order(m);
+        if (m == 0) {
+            return order;
+        }
+
+        auto timeOf = [&](uint32_t i) { return byStart ? activities[i].start : activities[i].finish; };
+        long long minT = timeOf(ids[0]), maxT = minT;
+        for (uint32_t i : ids) {
+            minT = std::min<long long>(minT, timeOf(i));
+            maxT = std::max<long long>(maxT, timeOf(i));
+        }
+
+        std::vector<uint64_t> keys(m), tmp(m);
+        for (size_t k = 0; k < m; k++) {
+            keys[k] = (static_cast<uint64_t>(timeOf(ids[k]) - minT) << 32) | ids[k];
+        }
+
+        const int digitBits = 11;
+        const size_t radix = size_t(1) << digitBits;
+        std::vector<size_t> count(radix);
+        for (int shift = 32; shift < 64 && ((static_cast<uint64_t>(maxT - minT) << 32) >> shift) != 0;
+             shift += digitBits) {
+            std::fill(count.begin(), count.end(), 0);
+            for (uint64_t key : keys) {
+                count[(key >> shift) & (radix - 1)]++;
+            }
+            size_t sum = 0;
+            for (size_t b = 0; b < radix; b++) {
+                size_t c = count[b];
+                count[b] = sum;
+                sum += c;
+            }
+            for (uint64_t key : keys) {
+                tmp[count[(key >> shift) & (radix - 1)]++] = key;
+            }
+            keys.swap(tmp);
+        }
+
+        for (size_t k = 0; k < m; k++) {
+            order[k] = static_cast<uint32_t>(keys[k]);
+        }
+        return order;
+    }
+};
+
+// Checks that no two activities on the same resource overlap
+bool isValidPartition(const std::vector<Activity>& activities, const Partition& p) {
+    std::vector<std::vector<Activity>> perResource(p.resourcesUsed);
+    for (size_t i = 0; i < activities.size(); i++) {
+        if (p.resource[i] >= 0) {
+            perResource[p.resource[i]].push_back(activities[i]);
+        }
+    }
+    for (auto& list : perResource) {
+        std::sort(list.begin(), list.end(), [](const Activity& a, const Activity& b) {
+            return a.finish != b.finish ? a.finish < b.finish : a.start < b.start;
+        });
+        for (size_t j = 1; j < list.size(); j++) {
+            if (list[j].start < list[j - 1].finish) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Largest number of pairwise-overlapping activities (small integer times only)
+int maxOverlap(const std::vector<Activity>& activities, int maxTime) {
+    int best = 0;
+    for (int t = 0; t <= maxTime; t++) {
+        int inside = 0, across = 0;
+        bool point = false;
+        for (const Activity& a : activities) {
+            inside += (a.start <= t && a.finish > t);      // covers (t, t + 1)
+            across += (a.start < t && a.finish > t);       // covers t itself
+            point = point || (a.start == t && a.finish == t);
+        }
+        best = std::max({best, inside, across + (point ? 1 : 0)});
+    }
+    return best;
+}
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main() {
+    std::cout << "--- Test Case 1: Same input as activity-selection.cpp ---\n";
+    std::vector<Activity> activities = {
+        {5, 9}, {1, 2}, {3, 4}, {0, 6},
+        {5, 7}, {8, 9}
+    };
+    Partition rooms = IntervalPartitioner::minResources(activities);
+    std::cout << "Minimum resources: " << rooms.resourcesUsed << "\n"; // Expected: 3
+    for (size_t i = 0; i < activities.size(); i++) {
+        std::cout << "(" << activities[i].start << ", " << activities[i].finish
+                  << ") -> resource " << rooms.resource[i] << "\n";
+    }
+
+    Partition one = IntervalPartitioner::kResources(activities, 1);
+    std::cout << "With k = 1: " << one.scheduled << " scheduled (same as selectActivities: 4)\n";
+
+    std::cout << "\n--- Test Case 2: Random input ---\n";
+    std::mt19937 rng(11);
+    std::vector<Activity> randomActs(20000);
+    for (auto& a : randomActs) {
+        a.start = static_cast<int>(rng() % 100000);
+        a.finish = a.start + static_cast<int>(rng() % 200);
+    }
+    Partition all = IntervalPartitioner::minResources(randomActs);
+    Partition three = IntervalPartitioner::kResources(randomActs, 3);
+    std::cout << "Minimum resources: " << all.resourcesUsed
+              << ", valid: " << (isValidPartition(randomActs, all) ? "Yes" : "No") << "\n";
+    std::cout << "k = 3: " << three.scheduled << " of " << randomActs.size()
+              << " scheduled, valid: " << (isValidPartition(randomActs, three) ? "Yes" : "No") << "\n";
+    Partition enough = IntervalPartitioner::kResources(randomActs, all.resourcesUsed);
+    std::cout << "k = " << all.resourcesUsed << ": all scheduled: "
+              << (enough.scheduled == randomActs.size() ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Test Case 3: Zero-length activities ---\n";
+    std::vector<Activity> point = {{2, 3}, {2, 2}, {1, 3}, {4, 6}};
+    Partition pointRooms = IntervalPartitioner::minResources(point);
+    std::cout << "Minimum resources: " << pointRooms.resourcesUsed                     // Expected: 2
+              << ", valid: " << (isValidPartition(point, pointRooms) ? "Yes" : "No") << "\n";
+    bool allOptimal = true;
+    for (int trial = 0; trial < 500; trial++) {
+        std::vector<Activity> acts(10);
+        for (auto& a : acts) {
+            a.start = static_cast<int>(rng() % 12);
+            a.finish = a.start + static_cast<int>(rng() % 4); // a quarter are zero-length
+        }
+        Partition p = IntervalPartitioner::minResources(acts);
+        allOptimal = allOptimal && isValidPartition(acts, p) && p.resourcesUsed == maxOverlap(acts, 16);
+    }
+    std::cout << "Random inputs valid and optimal: " << (allOptimal ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Benchmark: scaling ---\n";
+    for (size_t n : {1000000, 2000000, 4000000, 8000000}) {
+        std::vector<Activity> big(n);
+        for (auto& a : big) {
+            a.start = static_cast<int>(rng() % 1000000000);
+            a.finish = a.start + static_cast<int>(rng() % 10000) + 1;
+        }
+        auto t0 = std::chrono::steady_clock::now();
+        Partition p = IntervalPartitioner::minResources(big);
+        double minSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        t0 = std::chrono::steady_clock::now();
+        Partition q = IntervalPartitioner::kResources(big, 64);
+        double kSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::cout << n << " intervals: minResources " << minSec << " s (" << p.resourcesUsed
+                  << " resources), kResources(64) " << kSec << " s (" << q.scheduled << " scheduled)\n";
+    }
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
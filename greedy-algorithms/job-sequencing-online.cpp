@@ -0,0 +1,429 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <set>
+#include <string>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+
+// Reuse Job / jobSequencing without pulling in its demo main()
+#ifdef DSA_NO_MAIN
+#include "job-sequencing.cpp"
+#else
+#define DSA_NO_MAIN
+#include "job-sequencing.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Online Job Sequencing (incremental max-profit feasible set)
+ *
+ * jobSequencing() re-sorts and recomputes everything for every new job.
+ * Feasible job sets form a matroid, so the optimum can instead be kept
+ * up to date with single exchanges:
+ * - Insert j: if j fits, admit it. Otherwise the conflicting jobs are
+ *   exactly the scheduled jobs with deadline <= T, where T is the first
+ *   tight time >= deadline(j). Evict the cheapest of those (or reject j).
+ * - Remove e: drop it, then admit the most profitable rejected job whose
+ *   deadline lies after the last tight time (at most one can come back).
+ *
+ * "Tight" uses slack(t) = t - #{scheduled jobs with deadline <= t}; the
+ * set is feasible iff slack(t) >= 0 for every t.
+ *
+ * Everything lives in one dynamic segment tree over deadlines [1, H]
+ * (nodes created on demand), storing per node:
+ * - min slack (with a non-propagating range add)
+ * - cheapest scheduled job, most profitable rejected job
+ *
+ * Time: O(log H) per insert/remove, O(1) total profit
+ * Space: O(n log H)
+ */
+class OnlineJobScheduler {
+public:
+    using Handle = uint32_t;
+
+    /**
+     * Deadlines above `horizon` are clamped to it. This is exact as long as
+     * at most `horizon` jobs are live at once (no more could ever be
+     * scheduled), and a smaller horizon keeps the tree shallow.
+     */
+    explicit OnlineJobScheduler(int horizon = INT_MAX) : horizon_(horizon) {
+        nodes_.push_back(Node()); // root
+    }
+
+    /**
+     * Adds a job and returns its handle.
+     * Jobs with deadline <= 0 or profit <= 0 are never scheduled.
+     */
+    Handle insert(int deadline, int profit) {
+        Handle h = static_cast<Handle>(jobs_.size());
+        jobs_.push_back({std::min(deadline, horizon_), profit, State::Rejected});
+        Entry& job = jobs_.back();
+
+        if (job.deadline <= 0 || profit <= 0) {
+            job.state = State::Invalid;
+            return h;
+        }
+
+        int tight = firstZero(0, 1, horizon_, job.deadline, 0);
+        if (tight == kNone) {
+            schedule(h);
+            return h;
+        }
+
+        // Exchange argument: swap out the cheapest job that shares the conflict
+        Key cheapest = minScheduled(0, 1, horizon_, 1, tight);
+        if (cheapest.first < profit) {
+            unschedule(cheapest.second);
+            reject(cheapest.second);
+            schedule(h);
+        } else {
+            reject(h);
+        }
+        return h;
+    }
+
+    // Removes a job (scheduled or not). Returns false for unknown/removed handles.
+    bool remove(Handle h) {
+        if (h >= jobs_.size()) {
+            return false;
+        }
+        Entry& job = jobs_[h];
+        if (job.state == State::Removed) {
+            return false;
+        }
+        if (job.state == State::Invalid) {
+            job.state = State::Removed;
+            return true;
+        }
+        if (job.state == State::Rejected) {
+            updateLeaf(job.deadline, h, false, false);
+            job.state = State::Removed;
+            return true;
+        }
+
+        unschedule(h);
+        job.state = State::Removed;
+
+        // Refill: best rejected job that fits after the last tight time
+        int lastTight = lastZero(0, 1, horizon_, 0);
+        int from = (lastTight == kNone) ? 1 : lastTight + 1;
+        if (from <= horizon_) {
+            Key best = maxRejected(0, 1, horizon_, from, horizon_);
+            if (best.first > INT_MIN) {
+                updateLeaf(jobs_[best.second].deadline, best.second, false, false);
+                schedule(best.second);
+            }
+        }
+        return true;
+    }
+
+    long long totalProfit() const { return totalProfit_; }
+    size_t scheduledCount() const { return scheduledCount_; }
+    bool isScheduled(Handle h) const { return h < jobs_.size() && jobs_[h].state == State::Scheduled; }
+
+private:
+    static constexpr int kNone = -1;
+    using Key = std::pair<int, Handle>; // (profit, handle)
+
+    enum class State : uint8_t { Scheduled, Rejected, Removed, Invalid };
+
+    struct Entry {
+        int deadline;
+        int profit;
+        State state;
+    };
+
+    struct Node {
+        int left = -1, right = -1;
+        int add = 0;             // pending slack change for the whole subtree
+        int slackMin = 1;        // min slack in subtree, including `add`
+        Key minSched{INT_MAX, 0};
+        Key maxRej{INT_MIN, 0};
+        int bucket = -1;         // leaves only: index into buckets_
+    };
+
+    struct Bucket {
+        std::set<Key> scheduled, rejected;
+    };
+
+    int horizon_;
+    std::vector<Node> nodes_;
+    std::vector<Bucket> buckets_;
+    std::vector<Entry> jobs_;
+    long long totalProfit_ = 0;
+    size_t scheduledCount_ = 0;
+
+    void schedule(Handle h) {
+        Entry& job = jobs_[h];
+        job.state = State::Scheduled;
+        updateLeaf(job.deadline, h, true, true);
+        addSuffix(0, 1, horizon_, job.deadline, -1);
+        totalProfit_ += job.profit;
+        scheduledCount_++;
+    }
+
+    void unschedule(Handle h) {
+        Entry& job = jobs_[h];
+        updateLeaf(job.deadline, h, true, false);
+        addSuffix(0, 1, horizon_, job.deadline, +1);
+        totalProfit_ -= job.profit;
+        scheduledCount_--;
+    }
+
+    void reject(Handle h) {
+        jobs_[h].state = State::Rejected;
+        updateLeaf(jobs_[h].deadline, h, false, true);
+    }
+
+    // Returns the child covering [lo, ..], creating it untouched (slack(t) = t) if missing
+    int child(int node, bool right, int lo) {
+        int c = right ? nodes_[node].right : nodes_[node].left;
+        if (c == -1) {
+            c = static_cast<int>(nodes_.size());
+            nodes_.push_back(Node());
+            nodes_.back().slackMin = lo;
+            if (right) {
+                nodes_[node].right = c;
+            } else {
+                nodes_[node].left = c;
+            }
+        }
+        return c;
+    }
+
+    // Min slack of a child: an untouched range [lo, hi] has slack(t) = t
+    int childSlack(int c, int lo) const {
+        return c == -1 ? lo : nodes_[c].slackMin;
+    }
+
+    void pull(int node, int lo, int hi) {
+        Node& n = nodes_[node];
+        int mid = lo + (hi - lo) / 2;
+        n.slackMin = n.add + std::min(childSlack(n.left, lo), childSlack(n.right, mid + 1));
+        n.minSched = {INT_MAX, 0};
+        n.maxRej = {INT_MIN, 0};
+        for (int c : {n.left, n.right}) {
+            if (c != -1) {
+                n.minSched = std::min(n.minSched, nodes_[c].minSched);
+                n.maxRej = std::max(n.maxRej, nodes_[c].maxRej);
+            }
+        }
+    }
+
+    // slack(t) += delta for every t in [from, H]
+    void addSuffix(int node, int lo, int hi, int from, int delta) {
+        if (from <= lo) {
+            nodes_[node].add += delta;
+            nodes_[node].slackMin += delta;
+            return;
+        }
+        int mid = lo + (hi - lo) / 2;
+        if (from <= mid) {
+            addSuffix(child(node, false, lo), lo, mid, from, delta);
+        }
+        addSuffix(child(node, true, mid + 1), mid + 1, hi, from, delta);
+        pull(node, lo, hi);
+    }
+
+    // Inserts (add = true) or erases job h in the scheduled/rejected set of its deadline leaf
+    void updateLeaf(int deadline, Handle h, bool scheduledSet, bool add) {
+        updateLeaf(0, 1, horizon_, deadline, Key{jobs_[h].profit, h}, scheduledSet, add);
+    }
+
+    void updateLeaf(int node, int lo, int hi, int pos, Key key, bool scheduledSet, bool add) {
+        if (lo == hi) {
+            if (nodes_[node].bucket == -1) {
+                nodes_[node].bucket = static_cast<int>(buckets_.size());
+                buckets_.push_back(Bucket());
+            }
+            Bucket& b = buckets_[nodes_[node].bucket];
+            std::set<Key>& s = scheduledSet ? b.scheduled : b.rejected;
+            if (add) {
+                s.insert(key);
+            } else {
+                s.erase(key);
+            }
+            Node& n = nodes_[node];
+            n.minSched = b.scheduled.empty() ? Key{INT_MAX, 0} : *b.scheduled.begin();
+            n.maxRej = b.rejected.empty() ? Key{INT_MIN, 0} : *b.rejected.rbegin();
+            return;
+        }
+        int mid = lo + (hi - lo) / 2;
+        if (pos <= mid) {
+            updateLeaf(child(node, false, lo), lo, mid, pos, key, scheduledSet, add);
+        } else {
+            updateLeaf(child(node, true, mid + 1), mid + 1, hi, pos, key, scheduledSet, add);
+        }
+        pull(node, lo, hi);
+    }
+
+    // Leftmost t >= from with slack(t) == 0, or kNone. `acc` = adds of ancestors.
+    int firstZero(int node, int lo, int hi, int from, long long acc) const {
+        if (hi < from) {
+            return kNone;
+        }
+        if (node == -1) {
+            // Untouched range: slack(t) = acc + t, strictly increasing
+            long long t = std::max(lo, from);
+            return (acc + t == 0) ? static_cast<int>(t) : kNone;
+        }
+        const Node& n = nodes_[node];
+        if (acc + n.slackMin > 0) {
+            return kNone;
+        }
+        if (lo == hi) {
+            return lo;
+        }
+        int mid = lo + (hi - lo) / 2;
+        int t = firstZero(n.left, lo, mid, from, acc + n.add);
+        if (t == kNone) {
+            t = firstZero(n.right, mid + 1, hi, from, acc + n.add);
+        }
+        return t;
+    }
+
+    // Rightmost t with slack(t) == 0, or kNone
+    int lastZero(int node, int lo, int hi, long long acc) const {
+        if (node == -1) {
+            return (acc + lo == 0) ? lo : kNone;
+        }
+        const Node& n = nodes_[node];
+        if (acc + n.slackMin > 0) {
+            return kNone;
+        }
+        if (lo == hi) {
+            return lo;
+        }
+        int mid = lo + (hi - lo) / 2;
+        int t = lastZero(n.right, mid + 1, hi, acc + n.add);
+        if (t == kNone) {
+            t = lastZero(n.left, lo, mid, acc + n.add);
+        }
+        return t;
+    }
+
+    Key minScheduled(int node, int lo, int hi, int ql, int qr) const {
+        if (node == -1 || qr < lo || hi < ql) {
+            return {INT_MAX, 0};
+        }
+        if (ql <= lo && hi <= qr) {
+            return nodes_[node].minSched;
+        }
+        int mid = lo + (hi - lo) / 2;
+        return std::min(minScheduled(nodes_[node].left, lo, mid, ql, qr),
+                        minScheduled(nodes_[node].right, mid + 1, hi, ql, qr));
+    }
+
+    Key maxRejected(int node, int lo, int hi, int ql, int qr) const {
+        if (node == -1 || qr < lo || hi < ql) {
+            return {INT_MIN, 0};
+        }
+        if (ql <= lo && hi <= qr) {
+            return nodes_[node].maxRej;
+        }
+        int mid = lo + (hi - lo) / 2;
+        return std::max(maxRejected(nodes_[node].left, lo, mid, ql, qr),
+                        maxRejected(nodes_[node].right, mid + 1, hi, ql, qr));
+    }
+};
+
+// Runs jobSequencing with its output captured and returns the printed total profit
+long long referenceProfit(std::vector<Job> jobs) {
+    std::ostringstream captured;
+    std::streambuf* old = std::cout.rdbuf(captured.rdbuf());
+    jobSequencing(jobs);
+    std::cout.rdbuf(old);
+
+    std::string out = captured.str();
+    size_t pos = out.find("Total Profit: ");
+    return pos == std::string::npos ? 0 : std::stoll(out.substr(pos + 14));
+}
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main() {
+    std::cout << "--- Test Case 1: Same jobs as job-sequencing.cpp, one at a time ---\n";
+    std::vector<Job> jobs = {
+        {'a', 2, 100}, {'b', 1, 19}, {'c', 2, 27},
+        {'d', 1, 25}, {'e', 3, 15}
+    };
+    OnlineJobScheduler online;
+    std::vector<OnlineJobScheduler::Handle> handles;
+    for (const auto& job : jobs) {
+        handles.push_back(online.insert(job.deadline, job.profit));
+        std::cout << "After adding " << job.id << ": profit " << online.totalProfit() << "\n";
+    }
+    // Expected final profit: 142 (c, a, e)
+
+    std::cout << "\n--- Test Case 2: Removing a scheduled job brings one back ---\n";
+    online.remove(handles[0]); // drop 'a' (100)
+    std::cout << "After removing a: profit " << online.totalProfit()
+              << " (expected 67: d, c, e)\n";
+
+    std::cout << "\n--- Test Case 3: Random inserts/removes agree with jobSequencing ---\n";
+    std::mt19937 rng(7);
+    OnlineJobScheduler checked;
+    std::vector<Job> active;
+    std::vector<OnlineJobScheduler::Handle> activeHandles;
+    bool allMatch = true;
+    for (int step = 0; step < 3000; step++) {
+        if (!active.empty() && rng() % 3 == 0) {
+            size_t k = rng() % active.size();
+            checked.remove(activeHandles[k]);
+            active.erase(active.begin() + k);
+            activeHandles.erase(activeHandles.begin() + k);
+        } else {
+            Job job = {'j', static_cast<int>(rng() % 60) + 1, static_cast<int>(rng() % 1000) + 1};
+            active.push_back(job);
+            activeHandles.push_back(checked.insert(job.deadline, job.profit));
+        }
+        if (step % 50 == 0 && checked.totalProfit() != referenceProfit(active)) {
+            allMatch = false;
+        }
+    }
+    std::cout << "All checkpoints match: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Benchmark: profit after every insert ---\n";
+    const int batchJobs = 4000;
+    std::vector<Job> stream(batchJobs);
+    for (auto& job : stream) {
+        job = {'j', static_cast<int>(rng() % 2000) + 1, static_cast<int>(rng() % 100000) + 1};
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Job> growing;
+    long long batchSum = 0;
+    for (const auto& job : stream) {
+        growing.push_back(job);
+        batchSum += referenceProfit(growing); // recompute from scratch
+    }
+    double batchSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    OnlineJobScheduler bench;
+    long long onlineSum = 0;
+    for (const auto& job : stream) {
+        bench.insert(job.deadline, job.profit);
+        onlineSum += bench.totalProfit();
+    }
+    double onlineSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << batchJobs << " inserts - jobSequencing each time: " << batchSec << " s, online: "
+              << onlineSec << " s (" << (batchSum == onlineSum ? "same" : "DIFFERENT") << " results)\n";
+
+    const int bigJobs = 1000000;
+    start = std::chrono::steady_clock::now();
+    OnlineJobScheduler big(bigJobs); // exact: never more than bigJobs live jobs
+    for (int i = 0; i < bigJobs; i++) {
+        big.insert(static_cast<int>(rng() % 1000000000) + 1, static_cast<int>(rng() % 1000000) + 1);
+    }
+    double bigSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << bigJobs << " online inserts (deadlines up to 1e9, horizon 1e6): " << bigSec << " s, "
+              << bigJobs / bigSec / 1e6 << " M inserts/s\n";
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
@@ -1,6 +1,12 @@
+// Include guard: several drivers may reuse this file in one program
+#ifndef DSA_JOB_SEQUENCING_CPP
+#define DSA_JOB_SEQUENCING_CPP
+
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <cstring>
+#include "../datasets/dataset-layout.h"
 
 // Represents a job with an ID, deadline, and profit
 struct Job {
@@ -9,13 +15,31 @@ struct Job {
     int profit;
 };
 
+// How a Job is stored in a binary dataset; CSV columns: id, deadline, profit
+template <>
+struct dsa::DatasetLayout<Job> {
+    static constexpr dsa::ElementType type = dsa::ElementType::Job;
+    static constexpr std::size_t columns = 3;
+    static constexpr uint32_t letterColumns = 1 << 0; // id may be written as a letter
+    static constexpr uint32_t offsets[] = {offsetof(Job, id), offsetof(Job, deadline), offsetof(Job, profit)};
+    static bool fromColumns(const long long* c, Job& out) {
+        // Zero the 3 padding bytes after `id` too, so the bytes written to a file are deterministic
+        std::memset(&out, 0, sizeof(out));
+        out.id = static_cast<char>(c[0]);
+        out.deadline = static_cast<int>(c[1]);
+        out.profit = static_cast<int>(c[2]);
+        return out.id == c[0] && out.deadline == c[1] && out.profit == c[2];
+    }
+};
+
 // Comparison function to sort jobs by profit
 bool compareJobs(const Job& a, const Job& b) {
     return (a.profit > b.profit);
 }
 
 // Function to find the maximum profit job sequence
-void jobSequencing(std::vector<Job>& jobs) {
+// Sorts `jobs` in place (a vector or a copy-on-write dataset)
+void jobSequencing(dsa::Span<Job> jobs) {
       if (jobs.empty()) {
         std::cout << "No jobs to schedule.\n";
       return;
@@ -66,11 +90,30 @@ void jobSequencing(std::vector<Job>& jobs) {
     std::cout << "\nTotal Profit: " << totalProfit << std::endl;
 }
 
-int main() {
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+#include "../datasets/dataset.h"
+
+// Usage: job_sequencing [jobs.bin] (see datasets/README.md)
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        // Copy-on-write: sorting the jobs never modifies the file
+        dsa::Dataset<Job> data;
+        if (!data.open(argv[1])) {
+            std::cerr << "Cannot load " << argv[1] << ": " << data.error() << std::endl;
+            return 1;
+        }
+        jobSequencing(data.elements());
+        return 0;
+    }
+
     std::vector<Job> jobs = {
         {'a', 2, 100}, {'b', 1, 19}, {'c', 2, 27},
         {'d', 1, 25}, {'e', 3, 15}
     };
     jobSequencing(jobs);
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN
+
+#endif // DSA_JOB_SEQUENCING_CPP
@@ -0,0 +1,330 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <climits>
+
+// Reuse Activity without pulling in the activity-selection demo main()
+#ifdef DSA_NO_MAIN
+#include "activity-selection.cpp"
+#else
+#define DSA_NO_MAIN
+#include "activity-selection.cpp"
+#undef DSA_NO_MAIN
+#endif
+
+/**
+ * Weighted Interval Scheduling (with incremental updates)
+ *
+ * selectActivities() maximizes the NUMBER of activities. When every
+ * activity carries a value, the greedy no longer works and a DP over
+ * finish-sorted activities is needed:
+ *
+ *   pred[j]   = how many activities (in finish order, before j) end by start[j]
+ *   best[j+1] = max(best[j], value[j] + best[pred[j]])
+ *
+ * Ties on finish are ordered by start, so a zero-length (f, f) comes
+ * after every (s, f) it is compatible with and pred[j] never has to look
+ * past j.
+ *
+ * pred[j] comes from a branchless binary search over the finish array
+ * (the loop only moves a base pointer with a conditional select, so no
+ * mispredicted branches). The chosen set is rebuilt by walking best[]
+ * backwards.
+ *
+ * Incremental mode: best[0..k] only depends on the first k activities,
+ * so inserting or removing the activity at sorted position k only
+ * recomputes pred[] and best[] from k onwards. Appending intervals with
+ * late finish times (the usual case for a live log) is close to O(log n).
+ *
+ * Time: O(n log n) build, O((n - k) log n) per insert/remove at position k
+ * Space: O(n)
+ */
+class WeightedIntervalScheduler {
+public:
+    using Id = uint32_t;
+
+    // Builds from scratch; activity i gets id i
+    void build(const std::vector<Activity>& activities, const std::vector<long long>& values) {
+        const size_t n = activities.size();
+        std::vector<Id> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](Id a, Id b) {
+            if (activities[a].finish != activities[b].finish) {
+                return activities[a].finish < activities[b].finish;
+            }
+            return activities[a].start < activities[b].start;
+        });
+
+        start_.resize(n);
+        finish_.resize(n);
+        value_.resize(n);
+        id_.resize(n);
+        for (size_t k = 0; k < n; k++) {
+            start_[k] = activities[order[k]].start;
+            finish_[k] = activities[order[k]].finish;
+            value_[k] = values[order[k]];
+            id_[k] = order[k];
+        }
+        nextId_ = static_cast<Id>(n);
+        pred_.resize(n);
+        best_.resize(n + 1);
+        best_[0] = 0;
+        recomputeFrom(0);
+    }
+
+    // Adds an activity and returns its id
+    Id insert(const Activity& activity, long long value) {
+        // Among equal finish times, after every activity that starts no later
+        size_t k = std::upper_bound(start_.begin() + lowerBound(activity.finish),
+                                    start_.begin() + upperBound(activity.finish), activity.start) -
+                   start_.begin();
+        start_.insert(start_.begin() + k, activity.start);
+        finish_.insert(finish_.begin() + k, activity.finish);
+        value_.insert(value_.begin() + k, value);
+        id_.insert(id_.begin() + k, nextId_);
+        pred_.insert(pred_.begin() + k, 0);
+        best_.push_back(0);
+        recomputeFrom(k);
+        return nextId_++;
+    }
+
+    // Removes an activity by id (its times locate it). Returns false if it is not present.
+    bool remove(Id id, const Activity& activity) {
+        size_t k = lowerBound(activity.finish);
+        while (k < finish_.size() && finish_[k] == activity.finish && id_[k] != id) {
+            k++;
+        }
+        if (k == finish_.size() || id_[k] != id) {
+            return false;
+        }
+        start_.erase(start_.begin() + k);
+        finish_.erase(finish_.begin() + k);
+        value_.erase(value_.begin() + k);
+        id_.erase(id_.begin() + k);
+        pred_.erase(pred_.begin() + k);
+        best_.pop_back();
+        recomputeFrom(k);
+        return true;
+    }
+
+    long long bestValue() const { return best_.empty() ? 0 : best_.back(); }
+    size_t size() const { return finish_.size(); }
+
+    // Ids of an optimal set, in finish order
+    std::vector<Id> selected() const {
+        std::vector<Id> chosen;
+        size_t j = finish_.size();
+        while (j > 0) {
+            if (best_[j] != best_[j - 1]) {
+                chosen.push_back(id_[j - 1]); // activity j-1 is taken
+                j = pred_[j - 1];
+            } else {
+                j--;
+            }
+        }
+        std::reverse(chosen.begin(), chosen.end());
+        return chosen;
+    }
+
+private:
+    // Activities in (finish, start) order, one array per field
+    std::vector<int> start_, finish_;
+    std::vector<long long> value_;
+    std::vector<Id> id_;
+    std::vector<uint32_t> pred_;
+    std::vector<long long> best_; // best_[j] = optimum over the first j activities
+    Id nextId_ = 0;
+
+    // Number of activities with finish <= t (branchless binary search)
+    size_t upperBound(int t) const {
+        size_t n = finish_.size();
+        if (n == 0) {
+            return 0;
+        }
+        const int* base = finish_.data();
+        while (n > 1) {
+            size_t half = n / 2;
+            base = (base[half - 1] <= t) ? base + half : base;
+            n -= half;
+        }
+        return (base - finish_.data()) + (*base <= t);
+    }
+
+    // Number of activities with finish < t
+    size_t lowerBound(int t) const {
+        return t == INT_MIN ? 0 : upperBound(t - 1);
+    }
+
+    // Rebuilds pred_[k..] and best_[k+1..]; everything before k is still valid
+    void recomputeFrom(size_t k) {
+        const size_t n = finish_.size();
+        for (size_t j = k; j < n; j++) {
+            // Only earlier activities may precede j: a zero-length (f, f) counts
+            // itself and the later (f, f) ties, never an (s, f) it is compatible with
+            pred_[j] = static_cast<uint32_t>(std::min(upperBound(start_[j]), j));
+            best_[j + 1] = std::max(best_[j], value_[j] + best_[pred_[j]]);
+        }
+    }
+};
+
+// Exhaustive check for tiny inputs
+long long bruteForce(const std::vector<Activity>& acts, const std::vector<long long>& values) {
+    const size_t n = acts.size();
+    long long best = 0;
+    for (uint32_t mask = 0; mask < (1u << n); mask++) {
+        long long total = 0;
+        bool ok = true;
+        for (size_t i = 0; i < n && ok; i++) {
+            if (!(mask >> i & 1)) continue;
+            total += values[i];
+            for (size_t j = i + 1; j < n && ok; j++) {
+                if ((mask >> j & 1) && acts[i].start < acts[j].finish && acts[j].start < acts[i].finish) {
+                    ok = false;
+                }
+            }
+        }
+        if (ok) best = std::max(best, total);
+    }
+    return best;
+}
+
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+int main() {
+    std::cout << "--- Test Case 1: activity-selection.cpp input with values ---\n";
+    std::vector<Activity> activities = {
+        {5, 9}, {1, 2}, {3, 4}, {0, 6},
+        {5, 7}, {8, 9}
+    };
+    std::vector<long long> values = {10, 1, 1, 20, 1, 1};
+    WeightedIntervalScheduler wis;
+    wis.build(activities, values);
+    std::cout << "Best value: " << wis.bestValue() << "\nSelected:"; // Expected: 21 ((0, 6) + (8, 9))
+    for (auto id : wis.selected()) {
+        std::cout << " (" << activities[id].start << ", " << activities[id].finish << ")";
+    }
+    std::cout << "\n";
+
+    std::cout << "\n--- Test Case 2: Random small inputs vs brute force ---\n";
+    std::mt19937 rng(5);
+    bool allMatch = true;
+    for (int trial = 0; trial < 200; trial++) {
+        std::vector<Activity> acts(12);
+        std::vector<long long> vals(12);
+        for (size_t i = 0; i < acts.size(); i++) {
+            acts[i].start = static_cast<int>(rng() % 30);
+            acts[i].finish = acts[i].start + static_cast<int>(rng() % 9); // includes zero-length
+            vals[i] = static_cast<long long>(rng() % 50) + 1;
+        }
+        WeightedIntervalScheduler s;
+        s.build(acts, vals);
+        allMatch = allMatch && s.bestValue() == bruteForce(acts, vals);
+    }
+    // A zero-length activity ending with a longer one: (1, 1) + (0, 1) + (3, 4)
+    WeightedIntervalScheduler tie;
+    tie.build({{1, 1}, {0, 1}, {3, 4}}, {1, 7, 6});
+    allMatch = allMatch && tie.bestValue() == 14;
+    std::cout << "Zero-length tie: " << tie.bestValue() << "\n"; // Expected: 14
+    std::cout << "All match brute force: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Test Case 3: Incremental updates vs rebuild ---\n";
+    std::vector<Activity> live;
+    std::vector<long long> liveValues;
+    std::vector<WeightedIntervalScheduler::Id> liveIds;
+    WeightedIntervalScheduler inc;
+    inc.build(live, liveValues);
+    allMatch = true;
+    for (int step = 0; step < 2000; step++) {
+        if (!live.empty() && rng() % 3 == 0) {
+            size_t i = rng() % live.size();
+            inc.remove(liveIds[i], live[i]);
+            live.erase(live.begin() + i);
+            liveValues.erase(liveValues.begin() + i);
+            liveIds.erase(liveIds.begin() + i);
+        } else {
+            Activity a;
+            a.start = static_cast<int>(rng() % 1000);
+            a.finish = a.start + static_cast<int>(rng() % 50);
+            long long v = static_cast<long long>(rng() % 100) + 1;
+            live.push_back(a);
+            liveValues.push_back(v);
+            liveIds.push_back(inc.insert(a, v));
+        }
+        if (step % 100 == 0) {
+            WeightedIntervalScheduler fresh;
+            fresh.build(live, liveValues);
+            allMatch = allMatch && fresh.bestValue() == inc.bestValue();
+        }
+    }
+    std::cout << "Incremental matches rebuild: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Test Case 4: Small incremental updates vs brute force ---\n";
+    live.clear();
+    liveValues.clear();
+    liveIds.clear();
+    WeightedIntervalScheduler small;
+    small.build(live, liveValues);
+    allMatch = true;
+    for (int step = 0; step < 3000; step++) {
+        if (live.size() >= 12 || (!live.empty() && rng() % 3 == 0)) {
+            size_t i = rng() % live.size();
+            small.remove(liveIds[i], live[i]);
+            live.erase(live.begin() + i);
+            liveValues.erase(liveValues.begin() + i);
+            liveIds.erase(liveIds.begin() + i);
+        } else {
+            Activity a;
+            a.start = static_cast<int>(rng() % 20);
+            a.finish = a.start + static_cast<int>(rng() % 5); // many ties and zero-length ones
+            long long v = static_cast<long long>(rng() % 20) + 1;
+            live.push_back(a);
+            liveValues.push_back(v);
+            liveIds.push_back(small.insert(a, v));
+        }
+        allMatch = allMatch && small.bestValue() == bruteForce(live, liveValues);
+    }
+    std::cout << "Incremental matches brute force: " << (allMatch ? "Yes" : "No") << "\n";
+
+    std::cout << "\n--- Benchmark ---\n";
+    const size_t n = 2000000;
+    std::vector<Activity> big(n);
+    std::vector<long long> bigValues(n);
+    for (size_t i = 0; i < n; i++) {
+        big[i].start = static_cast<int>(rng() % 1000000000);
+        big[i].finish = big[i].start + static_cast<int>(rng() % 100000) + 1;
+        bigValues[i] = static_cast<long long>(rng() % 1000) + 1;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    WeightedIntervalScheduler bench;
+    bench.build(big, bigValues);
+    double buildSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Build " << n << " intervals: " << buildSec << " s (best " << bench.bestValue() << ")\n";
+
+    // New intervals near the end of the timeline, as in a live log
+    const int updates = 1000;
+    t0 = std::chrono::steady_clock::now();
+    for (int u = 0; u < updates; u++) {
+        int s = 1000000000 + static_cast<int>(rng() % 1000000);
+        bench.insert({s, s + static_cast<int>(rng() % 100000) + 1}, static_cast<long long>(rng() % 1000) + 1);
+    }
+    double tailSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << updates << " inserts near the end: " << tailSec * 1e6 / updates << " us each\n";
+
+    // Uniformly random positions recompute half the suffix on average
+    const int randomUpdates = 20;
+    t0 = std::chrono::steady_clock::now();
+    for (int u = 0; u < randomUpdates; u++) {
+        int s = static_cast<int>(rng() % 1000000000);
+        bench.insert({s, s + static_cast<int>(rng() % 100000) + 1}, static_cast<long long>(rng() % 1000) + 1);
+    }
+    double randomSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << randomUpdates << " inserts at random positions: " << randomSec * 1e3 / randomUpdates
+              << " ms each (full rebuild: " << buildSec * 1e3 << " ms)\n";
+
+    return 0;
+}
+#endif // DSA_NO_MAIN
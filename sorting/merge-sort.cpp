@@ -1,31 +1,45 @@
 #include <iostream>
 #include <vector>
+#include "../datasets/dataset-layout.h"
 
 using namespace std;
 
+// Profiling hooks (see benchmarks/perf-counters.h); no-ops unless that header is included first
+#ifndef DSA_PERF_REGION
+#define DSA_PERF_REGION(name, elements)
+#define DSA_PERF_REGION_IF(condition, name, elements)
+#endif
+
 /**
  * Helper function to merge two sorted subarrays
+ * Works on any contiguous int storage (vector or memory-mapped dataset);
+ * 64-bit indices so datasets beyond 2^31 elements work too
  * Time Complexity: O(n)
  * Space Complexity: O(n)
  */
-void merge(vector<int>& arr, int left, int mid, int right) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
+void merge(dsa::Span<int> arr, long long left, long long mid, long long right) {
+    long long n1 = mid - left + 1;
+    long long n2 = right - mid;
  
     // Create temp vectors
     vector<int> L(n1);
     vector<int> R(n2);
  
     // Copy data to temp vectors
-    for (int i = 0; i < n1; i++)
-        L[i] = arr[left + i];
-    for (int j = 0; j < n2; j++)
-        R[j] = arr[mid + 1 + j];
+    {
+        // Only large merges are measured; small ones would mostly time the counter reads
+        DSA_PERF_REGION_IF(n1 + n2 >= 4096, "merge-sort/copy", n1 + n2);
+        for (long long i = 0; i < n1; i++)
+            L[i] = arr[left + i];
+        for (long long j = 0; j < n2; j++)
+            R[j] = arr[mid + 1 + j];
+    }
  
     // Merge the temp vectors back into arr[left..right]
-    int i = 0;    // Initial index of first subarray
-    int j = 0;    // Initial index of second subarray
-    int k = left; // Initial index of merged subarray
+    DSA_PERF_REGION_IF(n1 + n2 >= 4096, "merge-sort/merge", n1 + n2);
+    long long i = 0;    // Initial index of first subarray
+    long long j = 0;    // Initial index of second subarray
+    long long k = left; // Initial index of merged subarray
  
     while (i < n1 && j < n2) {
         if (L[i] <= R[j]) {
@@ -59,10 +73,10 @@ void merge(vector<int>& arr, int left, int mid, int right) {
  * Time Complexity: O(n log n)
  * Space Complexity: O(n)
  */
-void mergeSort(vector<int>& arr, int left, int right) {
+void mergeSort(dsa::Span<int> arr, long long left, long long right) {
     if (left < right) {
         // Find middle point
-        int mid = left + (right - left) / 2;
+        long long mid = left + (right - left) / 2;
  
         // Sort first and second halves
         mergeSort(arr, left, mid);
@@ -81,8 +95,29 @@ void printVector(const vector<int>& arr) {
     cout << endl;
 }
  
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
+#include "../datasets/dataset.h"
+
 // Driver code to test the implementation
-int main() {
+// Usage: merge_sort [dataset.bin] - sorts an Int32 dataset (see datasets/README.md)
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        // Copy-on-write mapping: sorted in place in memory, the file stays unchanged
+        dsa::Dataset<int> data;
+        if (!data.open(argv[1])) {
+            cerr << "Cannot load " << argv[1] << ": " << data.error() << endl;
+            return 1;
+        }
+        dsa::Span<int> values = data.elements();
+        if (!values.empty()) {
+            mergeSort(values, 0, values.size() - 1);
+            cout << "Sorted " << values.size() << " elements: min " << values.front()
+                 << ", max " << values.back() << endl;
+        }
+        return 0;
+    }
+
     // Test case from the issue
     vector<int> arr = {5, 2, 4, 6, 1, 3};
     
@@ -96,3 +131,4 @@ int main() {
  
     return 0;
 }
+#endif // DSA_NO_MAIN
@@ -236,10 +236,13 @@ void testPalindrome() {
     }
 }
 
+// Define DSA_NO_MAIN to reuse this file from another driver
+#ifndef DSA_NO_MAIN
 int main() {
     testReversal();
     testWordReversal();
     testPalindrome();
     
     return 0;
-}
\ No newline at end of file
+}
+#endif // DSA_NO_MAIN